@@ -0,0 +1,101 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <Xyz/Mesh/BuildMesh.hpp>
+
+// Measures the cost per cuboid of build_mesh with the texture rectangles
+// given by a std::function and by a lambda.
+
+namespace
+{
+    using Builder2F = Xyz::MeshAttributeBuilder<Xyz::Vector2F, std::vector<float>>;
+    using Builder3F = Xyz::MeshAttributeBuilder<Xyz::Vector3F, std::vector<float>>;
+    using Builder4F = Xyz::MeshAttributeBuilder<Xyz::Vector4F, std::vector<float>>;
+    using Cuboid = Xyz::OrientedCuboid<float>;
+
+    constexpr std::array<Xyz::Rectangle<float>, 6> TEX_RECTS = {{
+        {{0.00f, 0}, {0.25f, 1}}, {{0.25f, 0}, {0.25f, 1}},
+        {{0.50f, 0}, {0.25f, 1}}, {{0.75f, 0}, {0.25f, 1}},
+        {{0.00f, 0}, {0.25f, 1}}, {{0.25f, 0}, {0.25f, 1}}
+    }};
+
+    template <typename BuildFunc>
+    double measure_ns_per_cuboid(const std::vector<Cuboid>& cuboids,
+                                 int repetitions,
+                                 BuildFunc build_func)
+    {
+        std::vector<uint32_t> indexes;
+        std::vector<float> buffer;
+        double best = 1e300;
+        for (int r = 0; r < repetitions; ++r)
+        {
+            indexes.clear();
+            buffer.clear();
+            Xyz::MeshBuilder builder{
+                .indexes = Xyz::MeshIndexBuilder<uint32_t>(indexes),
+                .coords = Builder3F(buffer, 12),
+                .normals = std::optional(Builder3F(buffer, 12, 3)),
+                .tangents = std::optional(Builder4F(buffer, 12, 6)),
+                .tex_coords = std::optional(Builder2F(buffer, 12, 10))
+            };
+            builder.reserve(Xyz::predict_mesh_size(Cuboid()) * cuboids.size());
+
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < cuboids.size(); ++i)
+                build_func(builder, cuboids[i], uint32_t(24 * i));
+            const auto end = std::chrono::steady_clock::now();
+
+            const std::chrono::duration<double, std::nano> elapsed = end - start;
+            best = std::min(best, elapsed.count() / double(cuboids.size()));
+        }
+        return best;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const size_t count = argc > 1 ? std::stoul(argv[1]) : 100000;
+    constexpr int REPETITIONS = 5;
+
+    std::vector<Cuboid> cuboids;
+    cuboids.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const auto x = float(i % 64), y = float(i / 64 % 64), z = float(i / 4096);
+        cuboids.push_back({{{x, y, z}, {}}, {1, 1, 1}});
+    }
+
+    const auto tex_rect_func = [](int face) {return TEX_RECTS[size_t(face)];};
+
+    const auto function_ns = measure_ns_per_cuboid(
+        cuboids, REPETITIONS,
+        [&](auto& builder, const Cuboid& cuboid, uint32_t base_index)
+        {
+            const std::function<Xyz::Rectangle<float>(int)> func = tex_rect_func;
+            Xyz::build_mesh(builder, cuboid, func, base_index);
+        });
+
+    const auto lambda_ns = measure_ns_per_cuboid(
+        cuboids, REPETITIONS,
+        [&](auto& builder, const Cuboid& cuboid, uint32_t base_index)
+        {
+            Xyz::build_mesh(builder, cuboid, tex_rect_func, base_index);
+        });
+
+    std::cout << std::fixed << std::setprecision(1)
+              << count << " cuboids, best of " << REPETITIONS << " runs\n"
+              << "std::function: " << function_ns << " ns per cuboid\n"
+              << "lambda:        " << lambda_ns << " ns per cuboid\n";
+    return EXIT_SUCCESS;
+}
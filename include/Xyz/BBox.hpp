@@ -6,7 +6,10 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #pragma once
+#include <span>
+
 #include "Matrix.hpp"
+#include "Parallel.hpp"
 #include "Vector.hpp"
 
 namespace Xyz
@@ -82,9 +85,53 @@ namespace Xyz
         return b + a;
     }
 
+    namespace Details
+    {
+        template <typename T, unsigned N>
+        BBox<T, N> transform_bbox_corners(const BBox<T, N>& box,
+                                          const Matrix<T, N + 1, N + 1>& m)
+        {
+            BBox<T, N> result;
+            for (unsigned i = 0; i < (1 << N); ++i)
+            {
+                Vector<T, N> corner;
+                for (unsigned j = 0; j < N; ++j)
+                    corner[j] = (i & (1 << j)) ? box.max[j] : box.min[j];
+                result += transform_vector(m, corner);
+            }
+            return result;
+        }
+
+        template <typename T, unsigned N>
+        BBox<T, N> transform_bbox_arvo(const BBox<T, N>& box,
+                                       const Matrix<T, N + 1, N + 1>& m)
+        {
+            BBox<T, N> result;
+            for (unsigned i = 0; i < N; ++i)
+            {
+                T min = m[i, N];
+                T max = m[i, N];
+                for (unsigned j = 0; j < N; ++j)
+                {
+                    const T a = m[i, j] * box.min[j];
+                    const T b = m[i, j] * box.max[j];
+                    min += std::min(a, b);
+                    max += std::max(a, b);
+                }
+                result.min[i] = min;
+                result.max[i] = max;
+            }
+            return result;
+        }
+    }
+
     /**
      * Returns the axis-aligned bounding box of @a box after it has been
      * transformed.
+     *
+     * If the final row of @a m consists of 0s followed by a single 1, the
+     * result is computed with transform_bbox_no_w, otherwise all 2^N
+     * corners of the box are transformed.
      */
     template <typename T, unsigned N>
     BBox<T, N> transform_bbox(const BBox<T, N>& box,
@@ -92,15 +139,9 @@ namespace Xyz
     {
         if (!box)
             return {};
-        BBox<T, N> result;
-        for (unsigned i = 0; i < (1 << N); ++i)
-        {
-            Vector<T, N> corner;
-            for (unsigned j = 0; j < N; ++j)
-                corner[j] = (i & (1 << j)) ? box.max[j] : box.min[j];
-            result += transform_vector(m, corner);
-        }
-        return result;
+        if (Details::is_affine(m))
+            return Details::transform_bbox_arvo(box, m);
+        return Details::transform_bbox_corners(box, m);
     }
 
     /**
@@ -110,6 +151,14 @@ namespace Xyz
      * This is an optimized version of transform_bbox, but must only be
      * used when the final row of matrix @a m consists of 0s followed by
      * a single 1.
+     *
+     * Rather than transforming every corner of the box, the function uses
+     * Arvo's method: each element of the linear part of @a m contributes
+     * either its product with the minimum or with the maximum coordinate to
+     * the new minimum, and the other product to the new maximum. This is
+     * equivalent to transforming the center of the box with @a m and its
+     * extents with the absolute values of @a m, and costs about as much as
+     * two vector transformations.
      */
     template <typename T, unsigned N>
     BBox<T, N> transform_bbox_no_w(const BBox<T, N>& box,
@@ -117,14 +166,150 @@ namespace Xyz
     {
         if (!box)
             return {};
-        BBox<T, N> result;
-        for (unsigned i = 0; i < (1 << N); ++i)
+        return Details::transform_bbox_arvo(box, m);
+    }
+
+    /**
+     * Transforms every box in @a boxes with transform_bbox_no_w and writes
+     * the results to @a result.
+     *
+     * @a result can be the same span as @a boxes.
+     * @throws XyzException if @a result is smaller than @a boxes.
+     */
+    template <typename T, unsigned M>
+    void transform_bboxes_no_w(
+        std::type_identity_t<std::span<const BBox<T, M - 1>>> boxes,
+        const Matrix<T, M, M>& m,
+        std::type_identity_t<std::span<BBox<T, M - 1>>> result)
+    {
+        if (result.size() < boxes.size())
+            XYZ_THROW("The result span is smaller than the boxes span.");
+
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            if (boxes[i])
+                result[i] = Details::transform_bbox_arvo(boxes[i], m);
+            else
+                result[i] = {};
+        }
+    }
+
+    /**
+     * Transforms every box in @a boxes with transform_bbox and writes
+     * the results to @a result.
+     *
+     * Whether @a m is affine is only checked once, not once per box.
+     *
+     * @a result can be the same span as @a boxes.
+     * @throws XyzException if @a result is smaller than @a boxes.
+     */
+    template <typename T, unsigned M>
+    void transform_bboxes(
+        std::type_identity_t<std::span<const BBox<T, M - 1>>> boxes,
+        const Matrix<T, M, M>& m,
+        std::type_identity_t<std::span<BBox<T, M - 1>>> result)
+    {
+        if (Details::is_affine(m))
         {
-            Vector<T, N> corner;
-            for (unsigned j = 0; j < N; ++j)
-                corner[j] = (i & (1 << j)) ? box.max[j] : box.min[j];
-            result += transform_vector_no_w(m, corner);
+            transform_bboxes_no_w(boxes, m, result);
+            return;
+        }
+
+        if (result.size() < boxes.size())
+            XYZ_THROW("The result span is smaller than the boxes span.");
+
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            if (boxes[i])
+                result[i] = Details::transform_bbox_corners(boxes[i], m);
+            else
+                result[i] = {};
+        }
+    }
+
+    namespace Details
+    {
+        /**
+         * @brief Returns the bounding box of @a count points stored as
+         *  consecutive N-tuples in @a values.
+         *
+         * The points are processed in blocks of LANES points, and each
+         * coordinate in a block has its own running minimum and maximum.
+         * The inner loops are then plain element-wise minimum and maximum
+         * operations on contiguous arrays, which the compiler turns into
+         * SIMD instructions.
+         */
+        template <typename T, unsigned N>
+        BBox<T, N> compute_bbox(const T* values, size_t count)
+        {
+            constexpr size_t LANES = 8;
+            constexpr size_t BLOCK = LANES * N;
+
+            T min[BLOCK];
+            T max[BLOCK];
+            std::fill(std::begin(min), std::end(min),
+                      std::numeric_limits<T>::max());
+            std::fill(std::begin(max), std::end(max),
+                      std::numeric_limits<T>::lowest());
+
+            const auto end = values + count * N;
+            const auto block_end = values + count / LANES * BLOCK;
+            for (; values != block_end; values += BLOCK)
+            {
+                for (size_t i = 0; i < BLOCK; ++i)
+                {
+                    min[i] = std::min(min[i], values[i]);
+                    max[i] = std::max(max[i], values[i]);
+                }
+            }
+
+            for (size_t i = 0; values != end; ++values, ++i)
+            {
+                min[i] = std::min(min[i], *values);
+                max[i] = std::max(max[i], *values);
+            }
+
+            BBox<T, N> result;
+            for (size_t i = 0; i < BLOCK; ++i)
+            {
+                result.min[i % N] = std::min(result.min[i % N], min[i]);
+                result.max[i % N] = std::max(result.max[i % N], max[i]);
+            }
+            return result;
         }
+    }
+
+    /**
+     * @brief Returns the bounding box of @a points.
+     *
+     * Returns an empty (invalid) box if @a points is empty.
+     *
+     * @param points The points.
+     * @param thread_count The number of threads to use. 0 means one per
+     *  hardware thread. Small inputs are always processed by the calling
+     *  thread alone.
+     */
+    template <typename T, unsigned N>
+    [[nodiscard]]
+    BBox<T, N> compute_bbox(std::span<const Vector<T, N>> points,
+                            unsigned thread_count = 1)
+    {
+        static_assert(sizeof(Vector<T, N>) == N * sizeof(T));
+        const auto* values = reinterpret_cast<const T*>(points.data());
+
+        std::vector<BBox<T, N>> boxes(
+            Details::get_chunk_count(points.size(), thread_count, 1 << 16));
+        Details::parallel_for(
+            points.size(), thread_count, 1 << 16,
+            [&](size_t chunk, size_t begin, size_t end)
+            {
+                boxes[chunk] = Details::compute_bbox<T, N>(values + begin * N,
+                                                           end - begin);
+            });
+
+        BBox<T, N> result;
+        for (const auto& box : boxes)
+            result += box;
         return result;
     }
 
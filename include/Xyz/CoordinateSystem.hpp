@@ -7,12 +7,71 @@
 //****************************************************************************
 #pragma once
 
+#include <span>
 #include "InvertMatrix.hpp"
 #include "Orientation.hpp"
 #include "PlanePlaneIntersection.hpp"
 
 namespace Xyz
 {
+    namespace Details
+    {
+        /**
+         * @brief Transforms every point in @a points with @a m and writes
+         *  the first K coordinates of the results to @a result.
+         *
+         * Points with N = 2 coordinates are treated as points with z = 0.
+         * If @a m is affine, the projective divide is skipped, and the
+         * matrix coefficients are copied to local variables so that they
+         * stay in registers even if @a result aliases @a points, which
+         * lets the compiler vectorize the loop.
+         */
+        template <std::floating_point T, unsigned N, unsigned K>
+        void transform_cs_points(const Matrix<T, 4, 4>& m,
+                                 std::span<const Vector<T, N>> points,
+                                 std::span<Vector<T, K>> result)
+        {
+            if (result.size() < points.size())
+                XYZ_THROW("The result span is smaller than the points span.");
+
+            if (!is_affine(m))
+            {
+                for (size_t i = 0; i < points.size(); ++i)
+                {
+                    Vector<T, 3> p(points[i][0], points[i][1], 0);
+                    if constexpr (N == 3)
+                        p[2] = points[i][2];
+                    result[i] = resize<K>(transform_vector(m, p));
+                }
+                return;
+            }
+
+            const T m00 = m[0, 0], m01 = m[0, 1], m02 = m[0, 2], m03 = m[0, 3];
+            const T m10 = m[1, 0], m11 = m[1, 1], m12 = m[1, 2], m13 = m[1, 3];
+            const T m20 = m[2, 0], m21 = m[2, 1], m22 = m[2, 2], m23 = m[2, 3];
+            for (size_t i = 0; i < points.size(); ++i)
+            {
+                const auto x = points[i][0];
+                const auto y = points[i][1];
+                auto rx = m00 * x + m01 * y + m03;
+                auto ry = m10 * x + m11 * y + m13;
+                auto rz = m20 * x + m21 * y + m23;
+                if constexpr (N == 3)
+                {
+                    const auto z = points[i][2];
+                    rx += m02 * z;
+                    ry += m12 * z;
+                    rz += m22 * z;
+                }
+
+                if constexpr (K == 3)
+                    result[i] = {rx, ry, rz};
+                else
+                    result[i] = {rx, ry};
+            }
+        }
+    }
+
     template <std::floating_point T>
     class CoordinateSystem
     {
@@ -106,6 +165,61 @@ namespace Xyz
             return transform_vector(from_cs_, Vector<T, 3>(p[0], p[1], 0));
         }
 
+        /**
+         * @brief Converts every point in @a points to this coordinate
+         *  system and writes the results to @a result.
+         *
+         * @a result can be the same span as @a points.
+         * @throws XyzException if @a result is smaller than @a points.
+         */
+        void to_cs(std::span<const Vector<T, 3>> points,
+                   std::span<Vector<T, 3>> result) const
+        {
+            Details::transform_cs_points(to_cs_, points, result);
+        }
+
+        /**
+         * @brief Converts every point in @a points from this coordinate
+         *  system and writes the results to @a result.
+         *
+         * @a result can be the same span as @a points.
+         * @throws XyzException if @a result is smaller than @a points.
+         */
+        void from_cs(std::span<const Vector<T, 3>> points,
+                     std::span<Vector<T, 3>> result) const
+        {
+            Details::transform_cs_points(from_cs_, points, result);
+        }
+
+        /**
+         * @brief Converts every point in @a points to this coordinate
+         *  system and writes their x and y coordinates to @a result,
+         *  i.e. projects them onto the coordinate system's xy-plane.
+         *
+         * @throws XyzException if @a result is smaller than @a points.
+         */
+        void to_cs_xy(std::span<const Vector<T, 3>> points,
+                      std::span<Vector<T, 2>> result) const
+        {
+            Details::transform_cs_points(to_cs_, points, result);
+        }
+
+        /**
+         * @brief Converts every point in @a points, which lie in this
+         *  coordinate system's xy-plane, from this coordinate system and
+         *  writes the results to @a result.
+         *
+         * The points' z coordinates are known to be 0, which saves a third
+         * of the multiplications.
+         *
+         * @throws XyzException if @a result is smaller than @a points.
+         */
+        void from_cs_xy(std::span<const Vector<T, 2>> points,
+                        std::span<Vector<T, 3>> result) const
+        {
+            Details::transform_cs_points(from_cs_, points, result);
+        }
+
     private:
         Matrix<T, 4, 4> from_cs_ = Matrix<T, 4, 4>::identity();
         Matrix<T, 4, 4> to_cs_ = Matrix<T, 4, 4>::identity();
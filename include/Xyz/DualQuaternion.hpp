@@ -0,0 +1,384 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstdint>
+#include <span>
+#include <utility>
+#include "Quaternion.hpp"
+
+namespace Xyz
+{
+    /**
+     * @brief A dual quaternion, i.e. real + ε * dual where ε² = 0.
+     *
+     * Unit dual quaternions represent rigid transformations, i.e. a
+     * rotation followed by a translation, in eight values rather than the
+     * twelve of an affine matrix. Unlike matrices, they can be blended
+     * without introducing scaling or shearing, which is what makes them
+     * useful for skinning.
+     *
+     * A unit dual quaternion has a unit quaternion as its real part, and a
+     * dual part that is orthogonal to it. The product dq1 * dq2 is the
+     * transformation dq2 followed by the transformation dq1.
+     */
+    template <std::floating_point T>
+    struct DualQuaternion
+    {
+        using ValueType = T;
+
+        /**
+         * @brief Creates the identity transformation.
+         */
+        constexpr DualQuaternion() noexcept
+            : real(),
+              dual(0, 0, 0, 0)
+        {}
+
+        constexpr DualQuaternion(const Quaternion<T>& real,
+                                 const Quaternion<T>& dual) noexcept
+            : real(real),
+              dual(dual)
+        {}
+
+        /**
+         * @brief The rotation.
+         */
+        Quaternion<T> real;
+
+        /**
+         * @brief Half the translation multiplied by the rotation.
+         */
+        Quaternion<T> dual;
+    };
+
+    template <std::floating_point T>
+    [[nodiscard]]
+    constexpr bool operator==(const DualQuaternion<T>& lhs,
+                              const DualQuaternion<T>& rhs)
+    {
+        return lhs.real == rhs.real && lhs.dual == rhs.dual;
+    }
+
+    template <std::floating_point T>
+    [[nodiscard]]
+    constexpr bool operator!=(const DualQuaternion<T>& lhs,
+                              const DualQuaternion<T>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <std::floating_point T>
+    std::ostream& operator<<(std::ostream& os, const DualQuaternion<T>& dq)
+    {
+        return os << "{real: " << dq.real << ", dual: " << dq.dual << "}";
+    }
+
+    template <std::floating_point T>
+    [[nodiscard]]
+    constexpr DualQuaternion<T> operator-(const DualQuaternion<T>& dq)
+    {
+        return {-dq.real, -dq.dual};
+    }
+
+    template <std::floating_point T>
+    [[nodiscard]]
+    constexpr DualQuaternion<T> operator+(const DualQuaternion<T>& lhs,
+                                          const DualQuaternion<T>& rhs)
+    {
+        return {lhs.real + rhs.real, lhs.dual + rhs.dual};
+    }
+
+    /**
+     * @brief Returns the product of @a lhs and @a rhs, i.e. the
+     *  transformation @a rhs followed by the transformation @a lhs.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    constexpr DualQuaternion<T> operator*(const DualQuaternion<T>& lhs,
+                                          const DualQuaternion<T>& rhs)
+    {
+        return {lhs.real * rhs.real,
+                lhs.real * rhs.dual + lhs.dual * rhs.real};
+    }
+
+    template <std::floating_point T>
+    [[nodiscard]]
+    constexpr DualQuaternion<T> operator*(const DualQuaternion<T>& dq,
+                                          std::type_identity_t<T> scalar)
+    {
+        return {dq.real * scalar, dq.dual * scalar};
+    }
+
+    template <std::floating_point T>
+    [[nodiscard]]
+    constexpr DualQuaternion<T> operator*(std::type_identity_t<T> scalar,
+                                          const DualQuaternion<T>& dq)
+    {
+        return dq * scalar;
+    }
+
+    /**
+     * @brief Returns the quaternion conjugate of both parts of @a dq.
+     *
+     * For a unit dual quaternion, this is the inverse transformation.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    constexpr DualQuaternion<T> conjugate(const DualQuaternion<T>& dq)
+    {
+        return {conjugate(dq.real), conjugate(dq.dual)};
+    }
+
+    /**
+     * @brief Returns the unit dual quaternion closest to @a dq.
+     *
+     * The real part is normalized, and the part of the dual part that
+     * isn't orthogonal to the real part is removed.
+     *
+     * @throws XyzException if the real part of @a dq is zero.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    DualQuaternion<T> normalize(const DualQuaternion<T>& dq)
+    {
+        const auto length = get_length(dq.real);
+        if (length == 0)
+            XYZ_THROW("The dual quaternion's real part is zero.");
+        const auto real = dq.real / length;
+        const auto dual = dq.dual / length;
+        return {real, dual - real * dot(real, dual)};
+    }
+
+    template <std::floating_point T>
+    [[nodiscard]]
+    bool are_equal(const DualQuaternion<T>& p, const DualQuaternion<T>& q,
+                   std::type_identity_t<T> margin = Margin<T>::DEFAULT)
+    {
+        return are_equal(p.real, q.real, margin)
+               && are_equal(p.dual, q.dual, margin);
+    }
+
+    /**
+     * @brief Returns true if @a p and @a q represent the same
+     *  transformation, i.e. if they are equal or one is the negation of
+     *  the other.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    bool are_equivalent(const DualQuaternion<T>& p, const DualQuaternion<T>& q,
+                        std::type_identity_t<T> margin = Margin<T>::DEFAULT)
+    {
+        return are_equal(p, q, margin) || are_equal(p, -q, margin);
+    }
+
+    /**
+     * @brief Returns the unit dual quaternion that rotates by @a rotation
+     *  and then translates by @a translation.
+     *
+     * @a rotation must be a unit quaternion.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    constexpr DualQuaternion<T>
+    make_dual_quaternion(const Quaternion<T>& rotation,
+                         const Vector<std::type_identity_t<T>, 3>& translation = {})
+    {
+        return {rotation, Quaternion<T>(0, translation * T(0.5)) * rotation};
+    }
+
+    /**
+     * @brief Returns the translation of the unit dual quaternion @a dq.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    constexpr Vector<T, 3> get_translation(const DualQuaternion<T>& dq)
+    {
+        // 2 * dual * conjugate(real), of which only the vector part is
+        // needed.
+        const auto& r = dq.real;
+        const auto& d = dq.dual;
+        return T(2) * (r.w * d.v - d.w * r.v - cross(d.v, r.v));
+    }
+
+    /**
+     * @brief Returns @a p transformed by the unit dual quaternion @a dq.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    constexpr Vector<T, 3> transform_point(const DualQuaternion<T>& dq,
+                                           const Vector<T, 3>& p)
+    {
+        const auto& r = dq.real;
+        const auto t = T(2) * cross(r.v, p);
+        return p + r.w * t + cross(r.v, t) + get_translation(dq);
+    }
+
+    /**
+     * @brief Returns @a v rotated by the unit dual quaternion @a dq,
+     *  ignoring its translation.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    constexpr Vector<T, 3> transform_vector(const DualQuaternion<T>& dq,
+                                            const Vector<T, 3>& v)
+    {
+        const auto& r = dq.real;
+        const auto t = T(2) * cross(r.v, v);
+        return v + r.w * t + cross(r.v, t);
+    }
+
+    namespace affine
+    {
+        /**
+         * @brief Returns the transformation matrix that corresponds to the
+         *  unit dual quaternion @a dq.
+         */
+        template <std::floating_point T>
+        [[nodiscard]]
+        Matrix<T, 4, 4> to_matrix(const DualQuaternion<T>& dq)
+        {
+            return to_matrix(dq.real, get_translation(dq));
+        }
+    }
+
+    /**
+     * @brief Returns the unit dual quaternion that corresponds to the
+     *  rotation and translation of the transformation matrix @a m.
+     *
+     * Any scaling, shearing or perspective in @a m is lost.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    DualQuaternion<T> to_dual_quaternion(const Matrix<T, 4, 4>& m)
+    {
+        return make_dual_quaternion(to_quaternion(m),
+                                    Vector<T, 3>(m[0, 3], m[1, 3], m[2, 3]));
+    }
+
+    namespace Details
+    {
+        template <std::floating_point T, std::integral IndexType>
+        DualQuaternion<T> blend_dual_quaternions(
+            std::span<const DualQuaternion<T>> joints,
+            const IndexType* indexes,
+            const T* weights,
+            size_t influences)
+        {
+            // Each joint is used with the sign that puts it in the same
+            // hemisphere as the first, otherwise the blend would take the
+            // long way round.
+            const auto& pivot = joints[indexes[0]].real;
+            DualQuaternion<T> sum({0, 0, 0, 0}, {0, 0, 0, 0});
+            for (size_t j = 0; j < influences; ++j)
+            {
+                const auto& joint = joints[indexes[j]];
+                const auto w = dot(pivot, joint.real) < 0 ? -weights[j] : weights[j];
+                sum.real = sum.real + joint.real * w;
+                sum.dual = sum.dual + joint.dual * w;
+            }
+            return normalize(sum);
+        }
+
+        template <std::integral IndexType, typename T>
+        void check_skinning_sizes(size_t joint_count,
+                                  std::span<const IndexType> joint_indexes,
+                                  std::span<const T> weights,
+                                  size_t influences,
+                                  size_t vertex_count)
+        {
+            if (influences == 0)
+                XYZ_THROW("The number of influences can't be 0.");
+            if (joint_indexes.size() != vertex_count * influences
+                || weights.size() != vertex_count * influences)
+            {
+                XYZ_THROW("The joint indexes and weights must have"
+                          " influences values per vertex.");
+            }
+            for (auto index : joint_indexes)
+            {
+                if (std::cmp_less(index, 0)
+                    || std::cmp_greater_equal(index, joint_count))
+                {
+                    XYZ_THROW("Joint index is out of range.");
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Computes the dual quaternion linear blend (DLB) of each
+     *  vertex' joints.
+     *
+     * Vertex i is influenced by the joints joint_indexes[i * influences]
+     * to joint_indexes[(i + 1) * influences - 1], with the corresponding
+     * weights. The blended dual quaternions are normalized, so the weights
+     * don't have to add up to 1.
+     *
+     * @param joints The joints' transformations as unit dual quaternions.
+     * @param joint_indexes @a influences indexes into @a joints per vertex.
+     * @param weights @a influences weights per vertex.
+     * @param influences The number of joints that influence each vertex.
+     * @param result One dual quaternion per vertex.
+     * @throws XyzException if the spans' sizes don't match, a joint index
+     *  is out of range or a vertex' blend is zero.
+     */
+    template <std::floating_point T, std::integral IndexType = uint32_t>
+    void blend_dual_quaternions(
+        std::type_identity_t<std::span<const DualQuaternion<T>>> joints,
+        std::type_identity_t<std::span<const IndexType>> joint_indexes,
+        std::type_identity_t<std::span<const T>> weights,
+        size_t influences,
+        std::span<DualQuaternion<T>> result)
+    {
+        Details::check_skinning_sizes(joints.size(), joint_indexes, weights,
+                                      influences, result.size());
+        for (size_t i = 0; i < result.size(); ++i)
+        {
+            result[i] = Details::blend_dual_quaternions(
+                joints, &joint_indexes[i * influences],
+                &weights[i * influences], influences);
+        }
+    }
+
+    /**
+     * @brief Transforms each point in @a points by the dual quaternion
+     *  linear blend (DLB) of its joints, and writes the results to
+     *  @a result.
+     *
+     * The blended dual quaternions aren't stored, see
+     * blend_dual_quaternions for the meaning of the other parameters.
+     *
+     * @a result can be the same span as @a points.
+     * @throws XyzException if the spans' sizes don't match, a joint index
+     *  is out of range or a vertex' blend is zero.
+     */
+    template <std::floating_point T, std::integral IndexType = uint32_t>
+    void skin_points(
+        std::type_identity_t<std::span<const DualQuaternion<T>>> joints,
+        std::type_identity_t<std::span<const IndexType>> joint_indexes,
+        std::type_identity_t<std::span<const T>> weights,
+        size_t influences,
+        std::type_identity_t<std::span<const Vector<T, 3>>> points,
+        std::span<Vector<T, 3>> result)
+    {
+        if (points.size() != result.size())
+            XYZ_THROW("The points and result spans have different sizes.");
+        Details::check_skinning_sizes(joints.size(), joint_indexes, weights,
+                                      influences, points.size());
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            const auto dq = Details::blend_dual_quaternions(
+                joints, &joint_indexes[i * influences],
+                &weights[i * influences], influences);
+            result[i] = transform_point(dq, points[i]);
+        }
+    }
+
+    using DualQuaternionF = DualQuaternion<float>;
+    using DualQuaternionD = DualQuaternion<double>;
+}
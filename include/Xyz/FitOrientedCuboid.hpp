@@ -0,0 +1,97 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "OrientedCuboid.hpp"
+#include "PointStatistics.hpp"
+#include "SymmetricEigenDecomposition.hpp"
+
+namespace Xyz
+{
+    /**
+     * @brief Returns an oriented cuboid that contains all of @a points.
+     *
+     * The cuboid's axes are the principal axes of the points, i.e. the
+     * eigenvectors of their covariance matrix, with the x-axis along the
+     * direction of greatest variance. The result is usually much tighter
+     * than the axis-aligned bounding box for elongated or slanted point
+     * sets, but it is not guaranteed to be the smallest possible cuboid.
+     *
+     * The points are read twice: once to compute the covariance and once
+     * to project them onto the axes.
+     *
+     * @param points The points.
+     * @param thread_count The number of threads to use. 0 means one per
+     *  hardware thread. Small inputs are always processed by the calling
+     *  thread alone.
+     * @return A cuboid with zero size at the origin if @a points is empty.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    OrientedCuboid<T>
+    fit_oriented_cuboid(std::span<const Vector<T, 3>> points,
+                        unsigned thread_count = 1)
+    {
+        if (points.empty())
+            return {};
+
+        const auto stats = compute_point_statistics(points, thread_count);
+        const auto eigen = get_symmetric_eigen_decomposition(stats.covariance);
+        const auto x = get_col(eigen.vectors, 0);
+        const auto y = get_col(eigen.vectors, 1);
+        // Guarantees a right-handed coordinate system.
+        const auto z = cross(x, y);
+
+        // The points are projected relative to the centroid to avoid
+        // losing precision when the points are far from the origin.
+        using Extent = std::pair<Vector<T, 3>, Vector<T, 3>>;
+        std::vector<Extent> extents(
+            Details::get_chunk_count(points.size(), thread_count, 1 << 16));
+        Details::parallel_for(
+            points.size(), thread_count, 1 << 16,
+            [&](size_t chunk, size_t begin, size_t end)
+            {
+                constexpr auto MAX = std::numeric_limits<T>::max();
+                Vector<T, 3> min(MAX, MAX, MAX);
+                Vector<T, 3> max(-MAX, -MAX, -MAX);
+                for (size_t i = begin; i < end; ++i)
+                {
+                    const auto d = points[i] - stats.centroid;
+                    const Vector<T, 3> p(dot(d, x), dot(d, y), dot(d, z));
+                    for (unsigned j = 0; j < 3; ++j)
+                    {
+                        min[j] = std::min(min[j], p[j]);
+                        max[j] = std::max(max[j], p[j]);
+                    }
+                }
+                extents[chunk] = {min, max};
+            });
+
+        auto [min, max] = extents[0];
+        for (size_t i = 1; i < extents.size(); ++i)
+        {
+            for (unsigned j = 0; j < 3; ++j)
+            {
+                min[j] = std::min(min[j], extents[i].first[j]);
+                max[j] = std::max(max[j], extents[i].second[j]);
+            }
+        }
+
+        return {
+            {
+                stats.centroid + x * min[0] + y * min[1] + z * min[2],
+                to_orientation(x, y)
+            },
+            max - min
+        };
+    }
+}
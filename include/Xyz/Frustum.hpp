@@ -0,0 +1,237 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <array>
+#include <cstdint>
+#include <span>
+
+#include "BBox.hpp"
+#include "Plane.hpp"
+
+namespace Xyz
+{
+    /**
+     * @brief The six planes that bound a view frustum.
+     *
+     * The normals have unit length and point into the frustum, so a point
+     * is inside the frustum when its signed distance to every plane is
+     * non-negative.
+     */
+    template <std::floating_point T>
+    struct Frustum
+    {
+        /**
+         * @brief The planes in the order left, right, bottom, top, near
+         *  and far.
+         */
+        std::array<Plane<T>, 6> planes;
+    };
+
+    namespace Details
+    {
+        template <std::floating_point T>
+        Plane<T> make_frustum_plane(const Vector<T, 4>& coefficients)
+        {
+            const Vector<T, 3> normal(coefficients[0],
+                                      coefficients[1],
+                                      coefficients[2]);
+            const auto length = get_length(normal);
+            if (length == 0)
+                XYZ_THROW("The matrix doesn't define a frustum.");
+            return {normal * (-coefficients[3] / (length * length)),
+                    normal / length};
+        }
+    }
+
+    /**
+     * @brief Returns the frustum that is mapped to the clip volume by
+     *  @a view_projection.
+     *
+     * @a view_projection is typically the product of a projection matrix,
+     * e.g. from make_frustum_matrix, and a view matrix, e.g. from
+     * make_look_at_matrix. If it is just a projection matrix, the frustum
+     * is in view coordinates.
+     *
+     * The planes are extracted with the Gribb-Hartmann method, i.e. they
+     * are sums and differences of the fourth row and each of the first three
+     * rows of the matrix.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    Frustum<T> make_frustum(const Matrix<T, 4, 4>& view_projection)
+    {
+        const auto r0 = get_row(view_projection, 0);
+        const auto r1 = get_row(view_projection, 1);
+        const auto r2 = get_row(view_projection, 2);
+        const auto r3 = get_row(view_projection, 3);
+        return {{
+            Details::make_frustum_plane(r3 + r0),
+            Details::make_frustum_plane(r3 - r0),
+            Details::make_frustum_plane(r3 + r1),
+            Details::make_frustum_plane(r3 - r1),
+            Details::make_frustum_plane(r3 + r2),
+            Details::make_frustum_plane(r3 - r2)
+        }};
+    }
+
+    template <std::floating_point T>
+    [[nodiscard]]
+    bool contains_point(const Frustum<T>& frustum, const Vector<T, 3>& point)
+    {
+        for (const auto& plane : frustum.planes)
+        {
+            if (get_signed_distance(plane, point) < 0)
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Returns false if the sphere with the given @a center and
+     *  @a radius is entirely outside @a frustum.
+     *
+     * The test is conservative: a sphere that is outside the frustum, but
+     * close to one of its edges or corners, can still return true.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    bool intersects(const Frustum<T>& frustum,
+                    const Vector<T, 3>& center,
+                    std::type_identity_t<T> radius)
+    {
+        for (const auto& plane : frustum.planes)
+        {
+            if (get_signed_distance(plane, center) < -radius)
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Returns false if @a box is entirely outside @a frustum.
+     *
+     * The test is conservative: a box that is outside the frustum, but
+     * close to one of its edges or corners, can still return true.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    bool intersects(const Frustum<T>& frustum, const BBox<T, 3>& box)
+    {
+        if (!box)
+            return false;
+
+        for (const auto& plane : frustum.planes)
+        {
+            // The corner that is farthest along the plane normal.
+            Vector<T, 3> corner;
+            for (unsigned i = 0; i < 3; ++i)
+                corner[i] = plane.normal[i] >= 0 ? box.max[i] : box.min[i];
+            if (get_signed_distance(plane, corner) < 0)
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Spans with the centers and extents (half sizes) of a number
+     *  of axis-aligned boxes, one span per coordinate.
+     *
+     * All six spans must have the same size.
+     */
+    template <std::floating_point T>
+    struct BBoxArrays
+    {
+        std::array<std::span<const T>, 3> centers;
+        std::array<std::span<const T>, 3> extents;
+
+        [[nodiscard]] size_t size() const
+        {
+            return centers[0].size();
+        }
+    };
+
+    /**
+     * @brief Tests every box in @a boxes against @a frustum and writes the
+     *  results to @a visibility as a bitmask.
+     *
+     * Bit i % 64 in @a visibility[i / 64] is set if box i intersects the
+     * frustum, and cleared if it is entirely outside. The test is the same
+     * conservative one as intersects(frustum, box). Unused bits in the last
+     * element are cleared.
+     *
+     * The boxes are processed in blocks of 64 with a branch-free inner
+     * loop, which lets the compiler vectorize the plane tests.
+     *
+     * @throws XyzException if the spans in @a boxes have different sizes
+     *  or @a visibility has fewer than (boxes.size() + 63) / 64 elements.
+     */
+    template <std::floating_point T>
+    void cull_bboxes(const Frustum<T>& frustum,
+                     const BBoxArrays<T>& boxes,
+                     std::span<uint64_t> visibility)
+    {
+        const auto count = boxes.size();
+        for (unsigned i = 0; i < 3; ++i)
+        {
+            if (boxes.centers[i].size() != count
+                || boxes.extents[i].size() != count)
+            {
+                XYZ_THROW("The box spans have different sizes.");
+            }
+        }
+
+        if (visibility.size() < (count + 63) / 64)
+            XYZ_THROW("The visibility span is too small.");
+
+        // Plane coefficients on the form ax + by + cz + d, and the absolute
+        // values of a, b and c, which project the extents onto the normal.
+        T a[6], b[6], c[6], d[6], abs_a[6], abs_b[6], abs_c[6];
+        for (unsigned i = 0; i < 6; ++i)
+        {
+            const auto& plane = frustum.planes[i];
+            a[i] = plane.normal[0];
+            b[i] = plane.normal[1];
+            c[i] = plane.normal[2];
+            d[i] = -dot(plane.normal, plane.origin);
+            abs_a[i] = std::abs(a[i]);
+            abs_b[i] = std::abs(b[i]);
+            abs_c[i] = std::abs(c[i]);
+        }
+
+        const T* cx = boxes.centers[0].data();
+        const T* cy = boxes.centers[1].data();
+        const T* cz = boxes.centers[2].data();
+        const T* ex = boxes.extents[0].data();
+        const T* ey = boxes.extents[1].data();
+        const T* ez = boxes.extents[2].data();
+
+        for (size_t block = 0; block < count; block += 64)
+        {
+            const auto block_size = std::min<size_t>(64, count - block);
+            uint64_t mask = 0;
+            for (size_t j = 0; j < block_size; ++j)
+            {
+                const auto k = block + j;
+                bool visible = true;
+                for (unsigned i = 0; i < 6; ++i)
+                {
+                    const auto distance = a[i] * cx[k] + b[i] * cy[k]
+                                          + c[i] * cz[k] + d[i];
+                    const auto radius = abs_a[i] * ex[k] + abs_b[i] * ey[k]
+                                        + abs_c[i] * ez[k];
+                    visible &= distance + radius >= 0;
+                }
+                mask |= uint64_t(visible) << j;
+            }
+            visibility[block / 64] = mask;
+        }
+    }
+
+    using FrustumF = Frustum<float>;
+    using FrustumD = Frustum<double>;
+}
@@ -123,4 +123,44 @@ namespace Xyz
             -m[1, 0] * w, m[0, 0] * w
         };
     }
+
+    namespace affine
+    {
+        /**
+         * @brief Returns the inverse of the affine transformation matrix
+         *  @a m, i.e. a 4x4 matrix whose bottom row is 0, 0, 0, 1.
+         *
+         * Only the upper left 3x3 part is inverted with cofactors, and the
+         * inverted translation is computed from it, which is less than half
+         * the work of inverting the full 4x4 matrix. The bottom row of
+         * @a m is ignored.
+         *
+         * @throws XyzException if @a m is not invertible.
+         */
+        template <typename T>
+        Matrix<T, 4, 4> invert(const Matrix<T, 4, 4>& m)
+        {
+            const Matrix<T, 3, 3> a{
+                m[0, 0], m[0, 1], m[0, 2],
+                m[1, 0], m[1, 1], m[1, 2],
+                m[2, 0], m[2, 1], m[2, 2]
+            };
+            auto c = Details::get_transposed_cofactors(a);
+            T det = 0;
+            for (unsigned i = 0; i < 3; ++i)
+                det += a[0, i] * c[i, 0];
+            if (det == 0)
+                XYZ_THROW("The matrix is not invertible.");
+            c *= T(1) / det;
+
+            const Vector<T, 3> t{m[0, 3], m[1, 3], m[2, 3]};
+            const auto u = c * t;
+            return {
+                c[0, 0], c[0, 1], c[0, 2], -u[0],
+                c[1, 0], c[1, 1], c[1, 2], -u[1],
+                c[2, 0], c[2, 1], c[2, 2], -u[2],
+                0, 0, 0, 1
+            };
+        }
+    }
 }
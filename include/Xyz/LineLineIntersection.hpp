@@ -13,6 +13,7 @@
 #include "IntersectionType.hpp"
 #include "Line.hpp"
 #include "LineSegment.hpp"
+#include "Predicates.hpp"
 
 namespace Xyz
 {
@@ -70,6 +71,39 @@ namespace Xyz
         return {IntersectionType::NON_INTERSECTING, t0, t1};
     }
 
+    /**
+     * @brief Returns INTERSECTING if @a a and @a b cross each other,
+     *  COLINEAR if all their end points are on the same line, and
+     *  NON_INTERSECTING otherwise.
+     *
+     * As with get_intersection_positions, segments that only touch, i.e.
+     * where an end point of one is on the other, don't intersect. Unlike
+     * get_intersection_positions, there is no margin: the test uses
+     * orient2d, and is exact for the coordinates converted to double.
+     */
+    template <typename T>
+    [[nodiscard]]
+    IntersectionType get_intersection_type(const LineSegment<T, 2>& a,
+                                           const LineSegment<T, 2>& b)
+    {
+        const auto a0 = vector_cast<double>(a.start);
+        const auto a1 = vector_cast<double>(a.end);
+        const auto b0 = vector_cast<double>(b.start);
+        const auto b1 = vector_cast<double>(b.end);
+        const auto o0 = orient2d(a0, a1, b0);
+        const auto o1 = orient2d(a0, a1, b1);
+        if (o0 == 0 && o1 == 0)
+            return IntersectionType::COLINEAR;
+        if ((o0 >= 0 && o1 >= 0) || (o0 <= 0 && o1 <= 0))
+            return IntersectionType::NON_INTERSECTING;
+
+        const auto o2 = orient2d(b0, b1, a0);
+        const auto o3 = orient2d(b0, b1, a1);
+        if ((o2 >= 0 && o3 >= 0) || (o2 <= 0 && o3 <= 0))
+            return IntersectionType::NON_INTERSECTING;
+        return IntersectionType::INTERSECTING;
+    }
+
     template <typename T, typename Float = FloatType_t<T>>
     std::pair<bool, std::pair<Float, Float>>
     get_projection_extent(const LineSegment<T, 2>& a,
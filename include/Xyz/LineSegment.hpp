@@ -79,13 +79,21 @@ namespace Xyz
         return {line.end, line.start};
     }
 
+    /**
+     * @brief Returns the point on @a line that is nearest to @a point.
+     *
+     * If @a line has zero length, its start point is returned.
+     */
     template <typename T, unsigned N>
     Vector<T, N> get_nearest_point(const LineSegment<T, N>& line,
                                    const Vector<T, N>& point)
     {
-        auto divisor = get_length_squared(line.vector());
-        auto t = (point - line.start) * line.vector() / divisor;
-        return get_point_at_t(line, clamp(t, 0.0, 1.0));
+        using Float = FloatType_t<T>;
+        const auto divisor = Float(get_length_squared(line.vector()));
+        if (divisor == 0)
+            return line.start;
+        const auto t = Float(dot(point - line.start, line.vector())) / divisor;
+        return get_point_at_t(line, clamp<Float>(t, 0, 1));
     }
 
     template <typename T>
@@ -95,6 +103,6 @@ namespace Xyz
         auto lv = line.vector();
         auto len = get_length_squared(lv);
         auto pv = point - line.start;
-        return make_vector2<T>(lv * pv / len, get_normal(lv) * pv / len);
+        return make_vector2<T>(dot(lv, pv) / len, dot(get_normal(lv), pv) / len);
     }
 }
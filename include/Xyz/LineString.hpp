@@ -0,0 +1,493 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <span>
+#include <vector>
+#include "BBox.hpp"
+#include "LineSegment.hpp"
+#include "Parallel.hpp"
+#include "Triangle.hpp"
+#include "XyzException.hpp"
+
+namespace Xyz
+{
+    /**
+     * @brief A position on a line string.
+     */
+    template <std::floating_point T, unsigned N>
+    struct LineStringPosition
+    {
+        /// The point itself.
+        Vector<T, N> point;
+        /// The index of the segment the point is on.
+        size_t segment = 0;
+        /// The distance from the line string's first point, measured
+        /// along the line string.
+        T distance = 0;
+    };
+
+    namespace Details
+    {
+        template <std::floating_point T, unsigned N>
+        T get_distance_squared(const BBox<T, N>& box, const Vector<T, N>& p)
+        {
+            T result = 0;
+            for (unsigned i = 0; i < N; ++i)
+            {
+                const auto d = std::max({box.min[i] - p[i], T(0), p[i] - box.max[i]});
+                result += d * d;
+            }
+            return result;
+        }
+    }
+
+    /**
+     * @brief A sequence of points connected by line segments, e.g. a GPS
+     *  track.
+     *
+     * The points are stored contiguously along with the cumulative length
+     * of the line string at each point, which makes the total length
+     * available in constant time and point_at_distance a binary search.
+     *
+     * The segments are also grouped in a hierarchy of bounding boxes: each
+     * leaf box encloses LEAF_SIZE consecutive segments, and each box above
+     * that encloses two boxes in the level below. Consecutive segments in
+     * tracks and other polylines tend to be close to each other, so the
+     * boxes are tight, and find_nearest_point only has to look at the
+     * segments in a few of them. The hierarchy is updated as points are
+     * added.
+     */
+    template <std::floating_point T, unsigned N>
+    class LineString
+    {
+    public:
+        using ValueType = T;
+        using Point = Vector<T, N>;
+
+        /// The number of segments in each leaf bounding box.
+        static constexpr size_t LEAF_SIZE = 16;
+
+        LineString() = default;
+
+        explicit LineString(std::span<const Point> points)
+        {
+            reserve(points.size());
+            for (const auto& p : points)
+                add_point(p);
+        }
+
+        void reserve(size_t point_count)
+        {
+            points_.reserve(point_count);
+            lengths_.reserve(point_count);
+        }
+
+        void add_point(const Point& p)
+        {
+            if (points_.empty())
+            {
+                points_.push_back(p);
+                lengths_.push_back(0);
+                return;
+            }
+
+            const auto prev = points_.back();
+            points_.push_back(p);
+            lengths_.push_back(lengths_.back() + T(get_length(p - prev)));
+            add_to_boxes(segment_count() - 1, prev, p);
+        }
+
+        [[nodiscard]] bool empty() const
+        {
+            return points_.empty();
+        }
+
+        /**
+         * @brief Returns the number of points.
+         */
+        [[nodiscard]] size_t size() const
+        {
+            return points_.size();
+        }
+
+        [[nodiscard]] size_t segment_count() const
+        {
+            return points_.empty() ? 0 : points_.size() - 1;
+        }
+
+        [[nodiscard]] std::span<const Point> points() const
+        {
+            return points_;
+        }
+
+        [[nodiscard]] const Point& operator[](size_t i) const
+        {
+            return points_[i];
+        }
+
+        [[nodiscard]] LineSegment<T, N> segment(size_t i) const
+        {
+            return {points_[i], points_[i + 1]};
+        }
+
+        /**
+         * @brief Returns the length of the line string from its first
+         *  point to each of its points.
+         */
+        [[nodiscard]] std::span<const T> cumulative_lengths() const
+        {
+            return lengths_;
+        }
+
+        [[nodiscard]] T length() const
+        {
+            return lengths_.empty() ? T(0) : lengths_.back();
+        }
+
+        [[nodiscard]] BBox<T, N> bounding_box() const
+        {
+            if (boxes_.empty())
+                return points_.empty() ? BBox<T, N>() : BBox<T, N>(points_[0]);
+            return boxes_.back()[0];
+        }
+
+        /**
+         * @brief Returns the position at @a distance along the line
+         *  string.
+         *
+         * Distances less than 0 or greater than the length of the line
+         * string are clamped.
+         *
+         * @throws XyzException if the line string is empty.
+         */
+        [[nodiscard]] LineStringPosition<T, N> point_at_distance(T distance) const
+        {
+            if (points_.empty())
+                XYZ_THROW("The line string is empty.");
+            if (points_.size() == 1)
+                return {points_[0], 0, 0};
+
+            distance = clamp<T>(distance, 0, length());
+            const auto it = std::upper_bound(lengths_.begin(), lengths_.end(),
+                                             distance);
+            const auto i = std::min(size_t(it - lengths_.begin()),
+                                    segment_count()) - 1;
+            const auto segment_length = lengths_[i + 1] - lengths_[i];
+            if (segment_length == 0)
+                return {points_[i], i, distance};
+            const auto t = (distance - lengths_[i]) / segment_length;
+            return {get_point_at_t(segment(i), t), i, distance};
+        }
+
+        /**
+         * @brief Writes the position at each distance in @a distances to
+         *  @a result.
+         *
+         * @throws XyzException if the line string is empty or @a result
+         *  is smaller than @a distances.
+         */
+        void points_at_distances(std::span<const T> distances,
+                                 std::span<LineStringPosition<T, N>> result) const
+        {
+            if (result.size() < distances.size())
+                XYZ_THROW("The result span is smaller than the distances span.");
+            for (size_t i = 0; i < distances.size(); ++i)
+                result[i] = point_at_distance(distances[i]);
+        }
+
+        /**
+         * @brief Returns the position on the line string that is nearest
+         *  to @a p.
+         *
+         * If several positions are equally near, the one on the segment
+         * with the lowest index is returned.
+         *
+         * @throws XyzException if the line string is empty.
+         */
+        [[nodiscard]] LineStringPosition<T, N>
+        find_nearest_point(const Point& p) const
+        {
+            if (points_.empty())
+                XYZ_THROW("The line string is empty.");
+            if (points_.size() == 1)
+                return {points_[0], 0, 0};
+
+            Nearest nearest;
+            find_nearest_point(p, boxes_.size() - 1, 0, nearest);
+            const auto i = nearest.segment;
+            return {
+                nearest.point, i,
+                lengths_[i] + T(get_length(nearest.point - points_[i]))
+            };
+        }
+
+        /**
+         * @brief Writes the position on the line string that is nearest to
+         *  each point in @a points to @a result.
+         *
+         * @param thread_count The number of threads the points are split
+         *  between, 0 means one per hardware thread.
+         * @throws XyzException if the line string is empty or @a result
+         *  is smaller than @a points.
+         */
+        void find_nearest_points(std::span<const Point> points,
+                                 std::span<LineStringPosition<T, N>> result,
+                                 unsigned thread_count = 1) const
+        {
+            if (result.size() < points.size())
+                XYZ_THROW("The result span is smaller than the points span.");
+            if (points_.empty())
+                XYZ_THROW("The line string is empty.");
+
+            Details::parallel_for(
+                points.size(), thread_count, MIN_CHUNK_SIZE,
+                [&](size_t, size_t begin, size_t end)
+                {
+                    for (auto i = begin; i < end; ++i)
+                        result[i] = find_nearest_point(points[i]);
+                });
+        }
+
+    private:
+        /// The smallest number of queries that is worth a thread of its own.
+        static constexpr size_t MIN_CHUNK_SIZE = 256;
+
+        struct Nearest
+        {
+            Point point;
+            size_t segment = 0;
+            T distance_squared = std::numeric_limits<T>::max();
+        };
+
+        void add_to_boxes(size_t segment, const Point& p0, const Point& p1)
+        {
+            auto index = segment / LEAF_SIZE;
+            for (size_t level = 0;; ++level)
+            {
+                if (level == 0 && boxes_.empty())
+                {
+                    boxes_.emplace_back();
+                }
+                else if (level == boxes_.size())
+                {
+                    // The level below has just got its second box, and
+                    // the new level's box must enclose both.
+                    const auto& children = boxes_[level - 1];
+                    boxes_.push_back({children[0] + children[1]});
+                }
+                auto& boxes = boxes_[level];
+                if (index == boxes.size())
+                    boxes.emplace_back(p0);
+                boxes[index] += p0;
+                boxes[index] += p1;
+
+                // Stop at the level with a single box that encloses
+                // everything.
+                if (boxes.size() == 1 && level + 1 == boxes_.size())
+                    break;
+                index /= 2;
+            }
+        }
+
+        void find_nearest_point(const Point& p, size_t level, size_t index,
+                                Nearest& nearest) const
+        {
+            if (level == 0)
+            {
+                const auto first = index * LEAF_SIZE;
+                const auto last = std::min(first + LEAF_SIZE, segment_count());
+                for (auto i = first; i < last; ++i)
+                {
+                    const auto q = get_nearest_point(segment(i), p);
+                    const auto d = get_length_squared(q - p);
+                    if (d < nearest.distance_squared
+                        || (d == nearest.distance_squared && i < nearest.segment))
+                    {
+                        nearest = {q, i, d};
+                    }
+                }
+                return;
+            }
+
+            // Visit the nearest child box first, as it is more likely to
+            // contain the nearest point, and the smaller the distance found
+            // so far, the more boxes can be skipped.
+            const auto& children = boxes_[level - 1];
+            const auto child = 2 * index;
+            const auto d0 = Details::get_distance_squared(children[child], p);
+            if (child + 1 == children.size())
+            {
+                if (d0 <= nearest.distance_squared)
+                    find_nearest_point(p, level - 1, child, nearest);
+                return;
+            }
+
+            const auto d1 = Details::get_distance_squared(children[child + 1], p);
+            const auto first = d1 < d0 ? child + 1 : child;
+            const auto second = d1 < d0 ? child : child + 1;
+            // Boxes at exactly the nearest distance found so far are still
+            // visited, as they may hold an equally near point on a segment
+            // with a lower index.
+            if (std::min(d0, d1) <= nearest.distance_squared)
+                find_nearest_point(p, level - 1, first, nearest);
+            if (std::max(d0, d1) <= nearest.distance_squared)
+                find_nearest_point(p, level - 1, second, nearest);
+        }
+
+        std::vector<Point> points_;
+        std::vector<T> lengths_;
+        /// The segment bounding boxes, leaves first.
+        std::vector<std::vector<BBox<T, N>>> boxes_;
+    };
+
+    namespace Details
+    {
+        template <std::floating_point T, unsigned N>
+        LineString<T, N> make_line_string(std::span<const Vector<T, N>> points,
+                                          const std::vector<char>& keep)
+        {
+            LineString<T, N> result;
+            for (size_t i = 0; i < points.size(); ++i)
+            {
+                if (keep[i])
+                    result.add_point(points[i]);
+            }
+            return result;
+        }
+    }
+
+    /**
+     * @brief Returns @a line_string simplified with the Douglas-Peucker
+     *  algorithm.
+     *
+     * The result contains the first and last points of @a line_string,
+     * and as few of the other points as possible while keeping every
+     * removed point within @a tolerance of the result.
+     */
+    template <std::floating_point T, unsigned N>
+    [[nodiscard]]
+    LineString<T, N> simplify_douglas_peucker(const LineString<T, N>& line_string,
+                                              std::type_identity_t<T> tolerance)
+    {
+        const auto points = line_string.points();
+        if (points.size() <= 2)
+            return line_string;
+
+        std::vector<char> keep(points.size(), 0);
+        keep.front() = keep.back() = 1;
+
+        // An explicit stack rather than recursion, as the recursion depth
+        // can be proportional to the number of points.
+        const auto tolerance_squared = tolerance * tolerance;
+        std::vector<std::pair<size_t, size_t>> stack{{0, points.size() - 1}};
+        while (!stack.empty())
+        {
+            const auto [first, last] = stack.back();
+            stack.pop_back();
+
+            const LineSegment<T, N> segment(points[first], points[last]);
+            T max_distance = 0;
+            size_t max_index = first;
+            for (auto i = first + 1; i < last; ++i)
+            {
+                const auto d = get_length_squared(
+                    get_nearest_point(segment, points[i]) - points[i]);
+                if (d > max_distance)
+                {
+                    max_distance = d;
+                    max_index = i;
+                }
+            }
+
+            if (max_distance > tolerance_squared)
+            {
+                keep[max_index] = 1;
+                stack.emplace_back(first, max_index);
+                stack.emplace_back(max_index, last);
+            }
+        }
+
+        return Details::make_line_string(points, keep);
+    }
+
+    /**
+     * @brief Returns @a line_string simplified with the
+     *  Visvalingam-Whyatt algorithm.
+     *
+     * Repeatedly removes the point that forms the triangle with the
+     * smallest area with its two neighbors, until all the remaining
+     * triangles have areas of at least @a min_area. The first and last
+     * points are never removed.
+     */
+    template <std::floating_point T, unsigned N>
+    [[nodiscard]]
+    LineString<T, N> simplify_visvalingam(const LineString<T, N>& line_string,
+                                          std::type_identity_t<T> min_area)
+    {
+        const auto points = line_string.points();
+        const auto n = points.size();
+        if (n <= 2)
+            return line_string;
+
+        // The remaining points are kept in a doubly linked list.
+        std::vector<size_t> prev(n), next(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            prev[i] = i - 1;
+            next[i] = i + 1;
+        }
+
+        const auto get_area = [&](size_t i)
+        {
+            const Triangle<T, N> triangle(points[prev[i]], points[i],
+                                          points[next[i]]);
+            return std::sqrt(std::max(get_area_squared(triangle), T(0)));
+        };
+
+        // A min-heap of (area, point) where an entry is out of date if the
+        // area no longer matches areas[point].
+        using Entry = std::pair<T, size_t>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<>> heap;
+        std::vector<T> areas(n, std::numeric_limits<T>::max());
+        for (size_t i = 1; i + 1 < n; ++i)
+        {
+            areas[i] = get_area(i);
+            heap.emplace(areas[i], i);
+        }
+
+        std::vector<char> keep(n, 1);
+        while (!heap.empty())
+        {
+            const auto [area, i] = heap.top();
+            if (area >= min_area)
+                break;
+            heap.pop();
+            if (!keep[i] || area != areas[i])
+                continue;
+
+            keep[i] = 0;
+            next[prev[i]] = next[i];
+            prev[next[i]] = prev[i];
+            for (const auto j : {prev[i], next[i]})
+            {
+                if (j == 0 || j == n - 1)
+                    continue;
+                // A neighbor's area is never allowed to drop below the
+                // area of the point that was just removed, otherwise it
+                // would be removed out of order.
+                areas[j] = std::max(get_area(j), area);
+                heap.emplace(areas[j], j);
+            }
+        }
+
+        return Details::make_line_string(points, keep);
+    }
+}
@@ -639,6 +639,25 @@ namespace Xyz
         return result;
     }
 
+    namespace Details
+    {
+        /**
+         * @brief Returns true if the final row of @a m is 0s followed by
+         *  a single 1, i.e. if transform_vector_no_w gives the same result
+         *  as transform_vector.
+         */
+        template <typename T, unsigned N>
+        bool is_affine(const Matrix<T, N, N>& m)
+        {
+            for (unsigned j = 0; j < N - 1; ++j)
+            {
+                if (m[N - 1, j] != 0)
+                    return false;
+            }
+            return m[N - 1, N - 1] == 1;
+        }
+    }
+
     using Matrix2I = Matrix<int, 2, 2>;
     using Matrix2F = Matrix<float, 2, 2>;
     using Matrix2D = Matrix<double, 2, 2>;
@@ -0,0 +1,290 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+#include "Xyz/Vector.hpp"
+
+namespace Xyz
+{
+    /**
+     * @brief An encoding converts the values given to a
+     *  MeshAttributeBuilder to the format that is stored in the buffer,
+     *  and back.
+     */
+    template <typename E, typename T>
+    concept AttributeEncoding = requires(const T& value,
+                                         const typename E::EncodedType& encoded)
+    {
+        { E::encode(value) } -> std::same_as<typename E::EncodedType>;
+        { E::decode(encoded) } -> std::convertible_to<T>;
+    }
+    && std::is_standard_layout_v<typename E::EncodedType>
+    && std::is_trivially_copyable_v<typename E::EncodedType>;
+
+    /**
+     * @brief Stores values as they are.
+     */
+    template <typename T>
+    struct IdentityEncoding
+    {
+        using EncodedType = T;
+
+        static constexpr EncodedType encode(const T& value)
+        {
+            return value;
+        }
+
+        static constexpr T decode(const EncodedType& value)
+        {
+            return value;
+        }
+    };
+
+    namespace Details
+    {
+        /**
+         * @brief Converts @a value to an IEEE 754 half-precision float,
+         *  rounding to nearest even.
+         */
+        inline uint16_t float_to_half(float value)
+        {
+            const auto bits = std::bit_cast<uint32_t>(value);
+            const auto sign = uint16_t((bits >> 16) & 0x8000u);
+            const auto abs = bits & 0x7FFFFFFFu;
+
+            // Infinity and NaN.
+            if (abs >= 0x7F800000u)
+                return uint16_t(sign | 0x7C00u | (abs > 0x7F800000u ? 0x200u : 0u));
+            // Values that round to infinity, i.e. 65520 and up.
+            if (abs >= 0x477FF000u)
+                return uint16_t(sign | 0x7C00u);
+            // Values that round to zero, i.e. 2^-25 and down.
+            if (abs <= 0x33000000u)
+                return sign;
+
+            uint32_t result;
+            uint32_t remainder;
+            uint32_t halfway;
+            if (abs < 0x38800000u)
+            {
+                // Subnormal halfs: the value is mantissa * 2^-24.
+                const auto shift = 126 - (abs >> 23);
+                const auto mantissa = (abs & 0x7FFFFFu) | 0x800000u;
+                result = mantissa >> shift;
+                remainder = mantissa & ((1u << shift) - 1);
+                halfway = 1u << (shift - 1);
+            }
+            else
+            {
+                // Change the exponent's bias from 127 to 15.
+                result = (abs - 0x38000000u) >> 13;
+                remainder = abs & 0x1FFFu;
+                halfway = 0x1000u;
+            }
+
+            // A carry from the mantissa correctly increments the exponent.
+            if (remainder > halfway || (remainder == halfway && (result & 1)))
+                ++result;
+            return uint16_t(sign | result);
+        }
+
+        /**
+         * @brief Converts the half-precision float @a value to float.
+         */
+        inline float half_to_float(uint16_t value)
+        {
+            const auto sign = uint32_t(value & 0x8000u) << 16;
+            const auto exponent = (value >> 10) & 0x1Fu;
+            const auto mantissa = uint32_t(value & 0x3FFu);
+
+            if (exponent == 0x1F)
+                return std::bit_cast<float>(sign | 0x7F800000u | (mantissa << 13));
+            if (exponent == 0)
+            {
+                const auto abs = std::ldexp(float(mantissa), -24);
+                return sign ? -abs : abs;
+            }
+            return std::bit_cast<float>(sign | ((exponent + 112) << 23)
+                                        | (mantissa << 13));
+        }
+
+        /**
+         * @brief Converts @a value in the range [-1, 1] to a signed
+         *  normalized integer with @a Bits bits.
+         */
+        template <unsigned Bits, std::floating_point T>
+        int32_t float_to_snorm(T value)
+        {
+            constexpr auto MAX = T((1 << (Bits - 1)) - 1);
+            return int32_t(std::round(std::clamp(value, T(-1), T(1)) * MAX));
+        }
+
+        template <unsigned Bits, std::floating_point T>
+        T snorm_to_float(int32_t value)
+        {
+            constexpr auto MAX = T((1 << (Bits - 1)) - 1);
+            // The smallest value is one less than -MAX, and also means -1.
+            return std::max(T(value) / MAX, T(-1));
+        }
+
+        template <std::floating_point T>
+        T sign_not_zero(T value)
+        {
+            return value < 0 ? T(-1) : T(1);
+        }
+    }
+
+    /**
+     * @brief Stores each component as a half-precision float.
+     *
+     * A half float has an 11-bit significand, so the absolute error is
+     * about 1/2048 for values with magnitude up to 1, which is about one
+     * texel in a 2048 pixel texture. The error doubles each time the
+     * magnitude doubles, and between 1024 and 2048 the spacing between
+     * values is 1. Use Snorm16Encoding for texture coordinates in [-1, 1]
+     * that need more precision, and full floats for tiled or large
+     * texture coordinates.
+     */
+    template <std::floating_point T, unsigned N>
+    struct HalfEncoding
+    {
+        using EncodedType = std::array<uint16_t, N>;
+
+        static EncodedType encode(const Vector<T, N>& value)
+        {
+            EncodedType result;
+            for (unsigned i = 0; i < N; ++i)
+                result[i] = Details::float_to_half(float(value[i]));
+            return result;
+        }
+
+        static Vector<T, N> decode(const EncodedType& value)
+        {
+            Vector<T, N> result;
+            for (unsigned i = 0; i < N; ++i)
+                result[i] = T(Details::half_to_float(value[i]));
+            return result;
+        }
+    };
+
+    /**
+     * @brief Stores each component, which must be in the range [-1, 1],
+     *  as a 16-bit signed normalized integer.
+     */
+    template <std::floating_point T, unsigned N>
+    struct Snorm16Encoding
+    {
+        using EncodedType = std::array<int16_t, N>;
+
+        static EncodedType encode(const Vector<T, N>& value)
+        {
+            EncodedType result;
+            for (unsigned i = 0; i < N; ++i)
+                result[i] = int16_t(Details::float_to_snorm<16>(value[i]));
+            return result;
+        }
+
+        static Vector<T, N> decode(const EncodedType& value)
+        {
+            Vector<T, N> result;
+            for (unsigned i = 0; i < N; ++i)
+                result[i] = Details::snorm_to_float<16, T>(value[i]);
+            return result;
+        }
+    };
+
+    /**
+     * @brief Stores a unit vector as two 16-bit signed normalized integers
+     *  with octahedral encoding.
+     *
+     * The unit sphere is projected onto an octahedron, whose lower half is
+     * folded over the upper half and flattened onto a square. The largest
+     * angular error is about 0.005 degrees. Shaders decode it with:
+     *
+     *     vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+     *     float t = max(-n.z, 0.0);
+     *     n.xy += mix(vec2(t), vec2(-t), greaterThanEqual(n.xy, vec2(0.0)));
+     *     n = normalize(n);
+     */
+    template <std::floating_point T>
+    struct OctahedralEncoding
+    {
+        using EncodedType = std::array<int16_t, 2>;
+
+        static EncodedType encode(const Vector<T, 3>& value)
+        {
+            const auto sum = std::abs(value[0]) + std::abs(value[1])
+                             + std::abs(value[2]);
+            if (sum == 0)
+                return {0, 0};
+
+            auto x = value[0] / sum;
+            auto y = value[1] / sum;
+            if (value[2] < 0)
+            {
+                const auto folded_x = (1 - std::abs(y)) * Details::sign_not_zero(x);
+                y = (1 - std::abs(x)) * Details::sign_not_zero(y);
+                x = folded_x;
+            }
+            return {int16_t(Details::float_to_snorm<16>(x)),
+                    int16_t(Details::float_to_snorm<16>(y))};
+        }
+
+        static Vector<T, 3> decode(const EncodedType& value)
+        {
+            auto x = Details::snorm_to_float<16, T>(value[0]);
+            auto y = Details::snorm_to_float<16, T>(value[1]);
+            const auto z = 1 - std::abs(x) - std::abs(y);
+            const auto t = std::max(-z, T(0));
+            x += x >= 0 ? -t : t;
+            y += y >= 0 ? -t : t;
+            return normalize(Vector<T, 3>(x, y, z));
+        }
+    };
+
+    /**
+     * @brief Stores a tangent with handedness, i.e. x, y and z in the range
+     *  [-1, 1] and w equal to -1 or 1, in a single 32-bit integer.
+     *
+     * x, y and z are 10-bit signed normalized integers in the lowest 30
+     * bits, and w is a 2-bit signed integer in the top two bits. This is
+     * the layout of OpenGL's GL_INT_2_10_10_10_REV and Vulkan's
+     * VK_FORMAT_A2B10G10R10_SNORM_PACK32.
+     */
+    template <std::floating_point T>
+    struct Snorm1010102Encoding
+    {
+        using EncodedType = uint32_t;
+
+        static EncodedType encode(const Vector<T, 4>& value)
+        {
+            const auto x = uint32_t(Details::float_to_snorm<10>(value[0]));
+            const auto y = uint32_t(Details::float_to_snorm<10>(value[1]));
+            const auto z = uint32_t(Details::float_to_snorm<10>(value[2]));
+            const auto w = uint32_t(Details::float_to_snorm<2>(value[3]));
+            return (x & 0x3FFu) | (y & 0x3FFu) << 10 | (z & 0x3FFu) << 20
+                   | (w & 0x3u) << 30;
+        }
+
+        static Vector<T, 4> decode(const EncodedType& value)
+        {
+            // Shift each field to the top, then sign-extend it back down.
+            return {Details::snorm_to_float<10, T>(int32_t(value << 22) >> 22),
+                    Details::snorm_to_float<10, T>(int32_t(value << 12) >> 22),
+                    Details::snorm_to_float<10, T>(int32_t(value << 2) >> 22),
+                    Details::snorm_to_float<2, T>(int32_t(value) >> 30)};
+        }
+    };
+}
@@ -6,20 +6,57 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #pragma once
+#include <algorithm>
 #include <concepts>
 #include <functional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 #include "MeshBuilder.hpp"
 #include "Xyz/OrientedCuboid.hpp"
+#include "Xyz/Parallel.hpp"
 #include "Xyz/Pgram.hpp"
 #include "Xyz/Rectangle.hpp"
 
 namespace Xyz
 {
+    /**
+     * @brief Returns the number of vertexes and indexes build_mesh adds
+     *  for @a pgram.
+     */
+    template <std::floating_point T>
+    constexpr MeshSize predict_mesh_size(const Pgram<T, 3>&)
+    {
+        return {4, 6};
+    }
+
+    /**
+     * @brief Returns the number of vertexes and indexes build_mesh adds
+     *  for @a rect.
+     */
+    template <std::floating_point T>
+    constexpr MeshSize predict_mesh_size(const OrientedRectangle<T, 3>&)
+    {
+        return {4, 6};
+    }
+
+    /**
+     * @brief Returns the number of vertexes and indexes build_mesh adds
+     *  for @a cuboid.
+     */
+    template <std::floating_point T>
+    constexpr MeshSize predict_mesh_size(const OrientedCuboid<T>&)
+    {
+        return {24, 36};
+    }
+
     template <ResizableBuffer BufferType,
         std::floating_point ValueType,
-        std::integral IndexType>
-    void build_mesh(MeshBuilder<BufferType, ValueType, IndexType>& builder,
+        std::integral IndexType,
+        typename... Encodings>
+    void build_mesh(MeshBuilder<BufferType, ValueType, IndexType, Encodings...>& builder,
                     const Pgram<ValueType, 3>& pgram,
                     const Rectangle<ValueType>& tex_rect = {},
                     std::type_identity_t<IndexType> base_index = {})
@@ -27,7 +64,6 @@ namespace Xyz
         const auto& v0 = pgram.edge0;
         const auto& v1 = pgram.edge1;
 
-        builder.coords.reserve(builder.coords.size() + 4);
         builder.coords.add(pgram.origin);
         builder.coords.add(pgram.origin + v0);
         builder.coords.add(pgram.origin + v0 + v1);
@@ -53,7 +89,6 @@ namespace Xyz
 
         if (builder.tex_coords)
         {
-            builder.tex_coords->reserve(builder.tex_coords->size() + 4);
             const auto [tv0, tv1] = get_vectors(tex_rect);
             builder.tex_coords->add(tex_rect.origin);
             builder.tex_coords->add(tex_rect.origin + tv0);
@@ -61,15 +96,15 @@ namespace Xyz
             builder.tex_coords->add(tex_rect.origin + tv1);
         }
 
-        builder.indexes.reserve(builder.indexes.size() + 6);
         builder.indexes.add(base_index + 0, base_index + 2, base_index + 3);
         builder.indexes.add(base_index + 0, base_index + 1, base_index + 2);
     }
 
     template <ResizableBuffer BufferType,
         std::floating_point ValueType,
-        std::integral IndexType>
-    void build_mesh(MeshBuilder<BufferType, ValueType, IndexType>& builder,
+        std::integral IndexType,
+        typename... Encodings>
+    void build_mesh(MeshBuilder<BufferType, ValueType, IndexType, Encodings...>& builder,
                     const OrientedRectangle<ValueType, 3>& rect,
                     const Rectangle<ValueType>& tex_rect = {},
                     std::type_identity_t<IndexType> base_index = {})
@@ -81,6 +116,36 @@ namespace Xyz
                    base_index);
     }
 
+    namespace Details
+    {
+        template <ResizableBuffer BufferType,
+            std::floating_point ValueType,
+            std::integral IndexType,
+            typename TexRectFunc,
+            typename... Encodings>
+        void build_cuboid_mesh(MeshBuilder<BufferType, ValueType, IndexType, Encodings...>& builder,
+                               const OrientedCuboid<ValueType>& cuboid,
+                               TexRectFunc& tex_rect_func,
+                               IndexType base_index)
+        {
+            using P = Pgram<ValueType, 3>;
+            const auto [x, y, z] = get_vectors(cuboid);
+            const auto& origin = cuboid.placement.origin;
+            build_mesh(builder, P(origin + y, -y, z),
+                       tex_rect_func(0), base_index);
+            build_mesh(builder, P(origin, x, z),
+                       tex_rect_func(1), base_index + 4);
+            build_mesh(builder, P(origin + x, y, z),
+                       tex_rect_func(2), base_index + 8);
+            build_mesh(builder, P(origin + x + y, -x, z),
+                       tex_rect_func(3), base_index + 12);
+            build_mesh(builder, P(origin + z, x, y),
+                       tex_rect_func(4), base_index + 16);
+            build_mesh(builder, P(origin + y, x, -y),
+                       tex_rect_func(5), base_index + 20);
+        }
+    }
+
     /**
      * @brief Builds a mesh for an OrientedCuboid.
      * @param builder The mesh builder to use.
@@ -93,38 +158,305 @@ namespace Xyz
      */
     template <ResizableBuffer BufferType,
         std::floating_point ValueType,
-        std::integral IndexType>
-    void build_mesh(MeshBuilder<BufferType, ValueType, IndexType>& builder,
+        std::integral IndexType,
+        typename... Encodings>
+    void build_mesh(MeshBuilder<BufferType, ValueType, IndexType, Encodings...>& builder,
                     const OrientedCuboid<ValueType>& cuboid,
                     std::function<Rectangle<ValueType>(int)> tex_rect_func = {},
                     std::type_identity_t<IndexType> base_index = {})
     {
-        using P = Pgram<ValueType, 3>;
-        using R = Rectangle<ValueType>;
-        const auto [x, y, z] = get_vectors(cuboid);
-        build_mesh(builder,
-                   P(cuboid.placement.origin + y, -y, z),
-                   tex_rect_func ? tex_rect_func(0) : R{},
-                   base_index);
-        build_mesh(builder,
-                   P(cuboid.placement.origin, x, z),
-                   tex_rect_func ? tex_rect_func(1) : R{},
-                   base_index + 4);
-        build_mesh(builder,
-                   P(cuboid.placement.origin + x, y, z),
-                   tex_rect_func ? tex_rect_func(2) : R{},
-                   base_index + 8);
-        build_mesh(builder,
-                   P(cuboid.placement.origin + x + y, -x, z),
-                   tex_rect_func ? tex_rect_func(3) : R{},
-                   base_index + 12);
-        build_mesh(builder,
-                   P(cuboid.placement.origin + z, x, y),
-                   tex_rect_func ? tex_rect_func(4) : R{},
-                   base_index + 16);
-        build_mesh(builder,
-                   P(cuboid.placement.origin + y, x, -y),
-                   tex_rect_func ? tex_rect_func(5) : R{},
-                   base_index + 20);
+        if (tex_rect_func)
+        {
+            Details::build_cuboid_mesh(builder, cuboid, tex_rect_func,
+                                       base_index);
+        }
+        else
+        {
+            auto default_func = [](int) {return Rectangle<ValueType>{};};
+            Details::build_cuboid_mesh(builder, cuboid, default_func,
+                                       base_index);
+        }
+    }
+
+    /**
+     * @brief Builds a mesh for an OrientedCuboid.
+     *
+     * Identical to the overload that takes a std::function, except that
+     * @a tex_rect_func can be any callable, e.g. a lambda, which the
+     * compiler can inline. Prefer this overload when building many cuboids.
+     */
+    template <ResizableBuffer BufferType,
+        std::floating_point ValueType,
+        std::integral IndexType,
+        typename TexRectFunc,
+        typename... Encodings>
+        requires std::is_invocable_r_v<Rectangle<ValueType>, TexRectFunc&, int>
+    void build_mesh(MeshBuilder<BufferType, ValueType, IndexType, Encodings...>& builder,
+                    const OrientedCuboid<ValueType>& cuboid,
+                    TexRectFunc&& tex_rect_func,
+                    std::type_identity_t<IndexType> base_index = {})
+    {
+        Details::build_cuboid_mesh(builder, cuboid, tex_rect_func, base_index);
+    }
+
+    namespace Details
+    {
+        template <AssignableType ValueType,
+                  ResizableBuffer BufferType,
+                  typename Encoding>
+        std::optional<MeshAttributeBuilder<ValueType, BufferType, Encoding>>
+        make_sub_builder(
+            const std::optional<MeshAttributeBuilder<ValueType, BufferType, Encoding>>& builder,
+            size_t first_row)
+        {
+            if (!builder)
+                return {};
+            return MeshAttributeBuilder<ValueType, BufferType, Encoding>(
+                builder->buffer(), builder->stride(), builder->offset(),
+                first_row);
+        }
+
+        /**
+         * @brief A fixed-size view of part of another buffer.
+         *
+         * Growing it beyond its size throws std::logic_error before
+         * anything is written, which prevents a builder from writing
+         * outside the rows it has been given.
+         */
+        template <typename T>
+        class BoundedBuffer
+        {
+        public:
+            using value_type = T;
+
+            BoundedBuffer(T* data, size_t size)
+                : data_(data),
+                  size_(size)
+            {}
+
+            void resize(size_t count)
+            {
+                if (count > size_)
+                {
+                    throw std::logic_error(
+                        "predict_mesh_size doesn't match build_mesh.");
+                }
+            }
+
+            [[nodiscard]] size_t size() const
+            {
+                return size_;
+            }
+
+            [[nodiscard]] T* data() const
+            {
+                return data_;
+            }
+
+        private:
+            T* data_;
+            size_t size_;
+        };
+
+        template <typename BufferType>
+        using BoundedBufferFor = BoundedBuffer<typename BufferType::value_type>;
+
+        /**
+         * @brief Returns a builder that writes @a rows rows to @a builder's
+         *  buffer, starting at @a first_row, through a BoundedBuffer that is
+         *  stored in @a buffer.
+         */
+        template <AssignableType ValueType,
+                  ResizableBuffer BufferType,
+                  typename Encoding>
+        MeshAttributeBuilder<ValueType, BoundedBufferFor<BufferType>, Encoding>
+        make_bounded_sub_builder(
+            const MeshAttributeBuilder<ValueType, BufferType, Encoding>& builder,
+            std::optional<BoundedBufferFor<BufferType>>& buffer,
+            size_t first_row,
+            size_t rows)
+        {
+            const auto stride = builder.stride();
+            buffer.emplace(builder.buffer().data() + first_row * stride,
+                           rows * stride);
+            return {*buffer, stride, builder.offset()};
+        }
+
+        template <AssignableType ValueType,
+                  ResizableBuffer BufferType,
+                  typename Encoding>
+        std::optional<MeshAttributeBuilder<ValueType, BoundedBufferFor<BufferType>, Encoding>>
+        make_bounded_sub_builder(
+            const std::optional<MeshAttributeBuilder<ValueType, BufferType, Encoding>>& builder,
+            std::optional<BoundedBufferFor<BufferType>>& buffer,
+            size_t first_row,
+            size_t rows)
+        {
+            if (!builder)
+                return {};
+            return make_bounded_sub_builder(*builder, buffer, first_row, rows);
+        }
+
+        template <ResizableBuffer BufferType,
+                  std::floating_point ValueType,
+                  std::integral IndexType,
+                  typename Shape,
+                  typename BuildFunc,
+                  typename... Encodings>
+        void build_meshes(MeshBuilder<BufferType, ValueType, IndexType, Encodings...>& builder,
+                          std::span<const Shape> shapes,
+                          unsigned thread_count,
+                          BuildFunc build_func)
+        {
+            // Compute where each shape's vertexes and indexes start.
+            std::vector<MeshSize> offsets(shapes.size() + 1);
+            for (size_t i = 0; i < shapes.size(); ++i)
+                offsets[i + 1] = offsets[i] + predict_mesh_size(shapes[i]);
+            const auto total = offsets.back();
+
+            // Grow the buffers once, and move the builders past the
+            // vertexes and indexes that are about to be filled in.
+            const auto coord_row = builder.coords.size();
+            const auto normal_row = builder.normals ? builder.normals->size() : 0;
+            const auto tangent_row = builder.tangents ? builder.tangents->size() : 0;
+            const auto tex_coord_row = builder.tex_coords ? builder.tex_coords->size() : 0;
+            builder.coords.resize(coord_row + total.vertexes);
+            if (builder.normals)
+                builder.normals->resize(normal_row + total.vertexes);
+            if (builder.tangents)
+                builder.tangents->resize(tangent_row + total.vertexes);
+            if (builder.tex_coords)
+                builder.tex_coords->resize(tex_coord_row + total.vertexes);
+
+            auto& index_buffer = builder.indexes.buffer();
+            const auto first_index = index_buffer.size();
+            index_buffer.resize(first_index + total.indexes);
+
+            parallel_for(
+                shapes.size(), thread_count, 1024,
+                [&](size_t, size_t begin, size_t end)
+                {
+                    // Each chunk writes its vertexes through bounded views
+                    // of its own rows, and its indexes to a local vector.
+                    // A shape that emits more vertexes than predicted is
+                    // stopped before it writes outside the chunk, and every
+                    // shape is checked against its prediction before the
+                    // indexes are copied to the shared buffer.
+                    const auto& offset = offsets[begin];
+                    const auto rows = offsets[end].vertexes - offset.vertexes;
+                    std::optional<BoundedBufferFor<BufferType>> coord_buffer;
+                    std::optional<BoundedBufferFor<BufferType>> normal_buffer;
+                    std::optional<BoundedBufferFor<BufferType>> tangent_buffer;
+                    std::optional<BoundedBufferFor<BufferType>> tex_coord_buffer;
+                    std::vector<IndexType> indexes;
+                    indexes.reserve(offsets[end].indexes - offset.indexes);
+                    MeshBuilder<BoundedBufferFor<BufferType>, ValueType, IndexType, Encodings...> sub_builder{
+                        .indexes = MeshIndexBuilder<IndexType>(
+                            indexes, builder.indexes.base_index()),
+                        .coords = make_bounded_sub_builder(
+                            builder.coords, coord_buffer,
+                            coord_row + offset.vertexes, rows),
+                        .normals = make_bounded_sub_builder(
+                            builder.normals, normal_buffer,
+                            normal_row + offset.vertexes, rows),
+                        .tangents = make_bounded_sub_builder(
+                            builder.tangents, tangent_buffer,
+                            tangent_row + offset.vertexes, rows),
+                        .tex_coords = make_bounded_sub_builder(
+                            builder.tex_coords, tex_coord_buffer,
+                            tex_coord_row + offset.vertexes, rows)
+                    };
+
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        build_func(sub_builder, shapes[i],
+                                   IndexType(coord_row + offsets[i].vertexes));
+                        if (indexes.size() != offsets[i + 1].indexes - offset.indexes
+                            || sub_builder.coords.size() != offsets[i + 1].vertexes - offset.vertexes)
+                        {
+                            throw std::logic_error(
+                                "predict_mesh_size doesn't match build_mesh.");
+                        }
+                    }
+
+                    std::copy(indexes.begin(), indexes.end(),
+                              index_buffer.begin() + ptrdiff_t(first_index + offset.indexes));
+                });
+        }
+    }
+
+    /**
+     * @brief Builds the meshes for all of @a shapes, using @a thread_count
+     *  threads.
+     *
+     * Equivalent to calling build_mesh for each shape in turn, with
+     * @a tex_arg as the texture argument and the number of vertexes in the
+     * builder as the base index. The vertex and index counts of each shape
+     * are computed with predict_mesh_size, the buffers are resized once,
+     * and then consecutive ranges of shapes are built in parallel directly
+     * into their final positions in the buffers.
+     *
+     * Throws std::logic_error if a shape adds a different number of
+     * vertexes or indexes than predict_mesh_size predicted. No shape can
+     * write outside the rows reserved for its range of shapes, but the
+     * contents of the reserved rows are unspecified after such an error.
+     *
+     * @param builder The mesh builder. Its attribute builders must have the
+     *  same number of rows.
+     * @param shapes The shapes, e.g. OrientedCuboids or Pgrams.
+     * @param tex_arg The texture argument that is passed to every
+     *  build_mesh call, e.g. a texture rectangle or a function that returns
+     *  the texture rectangles of a cuboid's faces. It is called
+     *  concurrently by several threads if @a thread_count isn't 1.
+     * @param thread_count The number of threads to use. 0 means one per
+     *  hardware thread. Small inputs are always processed by the calling
+     *  thread alone.
+     */
+    template <ResizableBuffer BufferType,
+              std::floating_point ValueType,
+              std::integral IndexType,
+              typename Shape,
+              typename TexArg,
+              typename... Encodings>
+        requires requires(MeshBuilder<BufferType, ValueType, IndexType, Encodings...>& b,
+                          const Shape& shape,
+                          const TexArg& tex_arg)
+        {
+            build_mesh(b, shape, tex_arg, IndexType());
+        }
+    void build_meshes(MeshBuilder<BufferType, ValueType, IndexType, Encodings...>& builder,
+                      std::span<const Shape> shapes,
+                      const TexArg& tex_arg,
+                      unsigned thread_count = 1)
+    {
+        Details::build_meshes(
+            builder, shapes, thread_count,
+            [&](auto& sub_builder, const Shape& shape, IndexType base_index)
+            {
+                build_mesh(sub_builder, shape, tex_arg, base_index);
+            });
+    }
+
+    /**
+     * @brief Builds the meshes for all of @a shapes with default texture
+     *  coordinates, using @a thread_count threads.
+     *
+     * See the overload with a texture argument.
+     */
+    template <ResizableBuffer BufferType,
+              std::floating_point ValueType,
+              std::integral IndexType,
+              typename Shape,
+              typename... Encodings>
+    void build_meshes(MeshBuilder<BufferType, ValueType, IndexType, Encodings...>& builder,
+                      std::span<const Shape> shapes,
+                      unsigned thread_count = 1)
+    {
+        Details::build_meshes(
+            builder, shapes, thread_count,
+            [&](auto& sub_builder, const Shape& shape, IndexType base_index)
+            {
+                build_mesh(sub_builder, shape, {}, base_index);
+            });
     }
 }
@@ -0,0 +1,524 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Xyz
+{
+    using VertexId = uint32_t;
+    using FaceId = uint32_t;
+    using HalfEdgeId = uint32_t;
+
+    constexpr VertexId INVALID_VERTEX_ID = ~VertexId{0};
+    constexpr FaceId INVALID_FACE_ID = ~FaceId{0};
+    constexpr HalfEdgeId INVALID_HALF_EDGE_ID = ~HalfEdgeId{0};
+
+    class HalfEdgeMesh;
+
+    /**
+     * @brief A range of half-edges that is traversed by repeatedly calling
+     *  a step function, until it returns INVALID_HALF_EDGE_ID or the first
+     *  half-edge.
+     */
+    class HalfEdgeRange
+    {
+    public:
+        using StepFunc = HalfEdgeId (*)(const HalfEdgeMesh&, HalfEdgeId);
+
+        class iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = HalfEdgeId;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const HalfEdgeId*;
+            using reference = HalfEdgeId;
+
+            iterator() = default;
+
+            iterator(const HalfEdgeMesh* mesh, StepFunc step, HalfEdgeId first)
+                : mesh_(mesh), step_(step), first_(first), current_(first)
+            {}
+
+            HalfEdgeId operator*() const
+            {
+                return current_;
+            }
+
+            iterator& operator++()
+            {
+                current_ = step_(*mesh_, current_);
+                if (current_ == first_)
+                    current_ = INVALID_HALF_EDGE_ID;
+                return *this;
+            }
+
+            iterator operator++(int)
+            {
+                auto result = *this;
+                ++*this;
+                return result;
+            }
+
+            bool operator==(const iterator& other) const
+            {
+                return current_ == other.current_;
+            }
+
+        private:
+            const HalfEdgeMesh* mesh_ = nullptr;
+            StepFunc step_ = nullptr;
+            HalfEdgeId first_ = INVALID_HALF_EDGE_ID;
+            HalfEdgeId current_ = INVALID_HALF_EDGE_ID;
+        };
+
+        HalfEdgeRange(const HalfEdgeMesh& mesh, StepFunc step, HalfEdgeId first)
+            : mesh_(&mesh), step_(step), first_(first)
+        {}
+
+        [[nodiscard]] iterator begin() const
+        {
+            return {mesh_, step_, first_};
+        }
+
+        [[nodiscard]] iterator end() const
+        {
+            return {};
+        }
+
+    private:
+        const HalfEdgeMesh* mesh_;
+        StepFunc step_;
+        HalfEdgeId first_;
+    };
+
+    /**
+     * @brief The vertexes that share an edge with a given vertex.
+     *
+     * For a vertex on the boundary, this includes the vertex at the far
+     * end of the incoming boundary edge, which isn't the destination of
+     * any of the vertex' outgoing half-edges.
+     */
+    class VertexNeighborRange
+    {
+    public:
+        class iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = VertexId;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const VertexId*;
+            using reference = VertexId;
+
+            iterator() = default;
+
+            iterator(const HalfEdgeMesh* mesh, HalfEdgeId first);
+
+            VertexId operator*() const;
+
+            iterator& operator++();
+
+            iterator operator++(int)
+            {
+                auto result = *this;
+                ++*this;
+                return result;
+            }
+
+            bool operator==(const iterator& other) const
+            {
+                return current_ == other.current_
+                       && incoming_ == other.incoming_;
+            }
+
+        private:
+            const HalfEdgeMesh* mesh_ = nullptr;
+            HalfEdgeId first_ = INVALID_HALF_EDGE_ID;
+            HalfEdgeId current_ = INVALID_HALF_EDGE_ID;
+            /// Set when the current neighbor is the origin of this
+            /// incoming boundary half-edge.
+            HalfEdgeId incoming_ = INVALID_HALF_EDGE_ID;
+        };
+
+        VertexNeighborRange(const HalfEdgeMesh& mesh, HalfEdgeId first)
+            : mesh_(&mesh), first_(first)
+        {}
+
+        [[nodiscard]] iterator begin() const
+        {
+            return {mesh_, first_};
+        }
+
+        [[nodiscard]] iterator end() const
+        {
+            return {};
+        }
+
+    private:
+        const HalfEdgeMesh* mesh_;
+        HalfEdgeId first_;
+    };
+
+    /**
+     * @brief The connectivity of a triangle mesh as half-edges.
+     *
+     * The half-edges of face f are 3f, 3f + 1 and 3f + 2, in the same order
+     * as the face's indexes, so the face, next and previous half-edges are
+     * computed rather than stored. The mesh itself is stored as flat arrays
+     * of 32-bit IDs: the origin vertex and the twin of each half-edge, and
+     * one outgoing half-edge per vertex. Vertex coordinates and other
+     * attributes are not stored, they are looked up by VertexId in the
+     * buffers the mesh was built from.
+     *
+     * Half-edges without a twin are on the boundary. An edge that is shared
+     * by more than two faces, or by two faces with opposite orientations,
+     * is non-manifold, and only one pair of its half-edges become twins.
+     * Vertexes where several fans of faces meet at a single point are
+     * non-manifold too, and their rings only include one of the fans.
+     *
+     * None of the traversals allocate memory.
+     */
+    class HalfEdgeMesh
+    {
+    public:
+        HalfEdgeMesh() = default;
+
+        /**
+         * @brief Builds the half-edge mesh for the triangle list
+         *  @a indexes in linear time.
+         *
+         * @param indexes Three indexes per triangle, e.g. the indexes
+         *  written by MeshBuilder.
+         * @param vertex_count The number of vertexes @a indexes refers to.
+         * @throws std::invalid_argument if the number of indexes isn't a
+         *  multiple of 3, an index is out of range or there are too many
+         *  indexes or vertexes for 32-bit IDs.
+         */
+        template <std::integral IndexType>
+        HalfEdgeMesh(std::span<const IndexType> indexes, size_t vertex_count)
+        {
+            if (indexes.size() % 3 != 0)
+                throw std::invalid_argument(
+                    "The number of indexes is not a multiple of 3.");
+            if (indexes.size() >= INVALID_HALF_EDGE_ID
+                || vertex_count >= INVALID_VERTEX_ID)
+            {
+                throw std::invalid_argument("The mesh is too large.");
+            }
+
+            origins_.resize(indexes.size());
+            for (size_t i = 0; i < indexes.size(); ++i)
+            {
+                if (std::cmp_less(indexes[i], 0)
+                    || std::cmp_greater_equal(indexes[i], vertex_count))
+                {
+                    throw std::invalid_argument("Index is out of range.");
+                }
+                origins_[i] = VertexId(indexes[i]);
+            }
+
+            vertex_half_edges_.assign(vertex_count, INVALID_HALF_EDGE_ID);
+            twins_.assign(indexes.size(), INVALID_HALF_EDGE_ID);
+            connect_twins();
+        }
+
+        template <std::integral IndexType>
+        HalfEdgeMesh(const std::vector<IndexType>& indexes, size_t vertex_count)
+            : HalfEdgeMesh(std::span<const IndexType>(indexes), vertex_count)
+        {}
+
+        [[nodiscard]] size_t vertex_count() const
+        {
+            return vertex_half_edges_.size();
+        }
+
+        [[nodiscard]] size_t face_count() const
+        {
+            return origins_.size() / 3;
+        }
+
+        [[nodiscard]] size_t half_edge_count() const
+        {
+            return origins_.size();
+        }
+
+        /**
+         * @brief Returns half-edge @a i of face @a f, which goes from the
+         *  face's vertex i to vertex (i + 1) % 3.
+         */
+        [[nodiscard]] static HalfEdgeId half_edge(FaceId f, unsigned i)
+        {
+            return 3 * f + i;
+        }
+
+        [[nodiscard]] static FaceId face(HalfEdgeId h)
+        {
+            return h / 3;
+        }
+
+        [[nodiscard]] static HalfEdgeId next(HalfEdgeId h)
+        {
+            return h % 3 == 2 ? h - 2 : h + 1;
+        }
+
+        [[nodiscard]] static HalfEdgeId prev(HalfEdgeId h)
+        {
+            return h % 3 == 0 ? h + 2 : h - 1;
+        }
+
+        [[nodiscard]] VertexId origin(HalfEdgeId h) const
+        {
+            return origins_[h];
+        }
+
+        [[nodiscard]] VertexId destination(HalfEdgeId h) const
+        {
+            return origins_[next(h)];
+        }
+
+        /**
+         * @brief Returns the half-edge in the opposite direction in the
+         *  neighboring face, or INVALID_HALF_EDGE_ID if @a h is on the
+         *  boundary.
+         */
+        [[nodiscard]] HalfEdgeId twin(HalfEdgeId h) const
+        {
+            return twins_[h];
+        }
+
+        [[nodiscard]] bool is_boundary(HalfEdgeId h) const
+        {
+            return twins_[h] == INVALID_HALF_EDGE_ID;
+        }
+
+        /**
+         * @brief Returns a half-edge that starts at @a v, or
+         *  INVALID_HALF_EDGE_ID if no face uses @a v.
+         *
+         * If @a v is on the boundary, the half-edge is the outgoing
+         * boundary half-edge.
+         */
+        [[nodiscard]] HalfEdgeId vertex_half_edge(VertexId v) const
+        {
+            return vertex_half_edges_[v];
+        }
+
+        [[nodiscard]] bool is_boundary_vertex(VertexId v) const
+        {
+            const auto h = vertex_half_edges_[v];
+            return h != INVALID_HALF_EDGE_ID && is_boundary(h);
+        }
+
+        /**
+         * @brief Returns the half-edge that starts at the same vertex as
+         *  @a h, in the next face counterclockwise around the vertex, or
+         *  INVALID_HALF_EDGE_ID if there is a boundary in between.
+         */
+        [[nodiscard]] HalfEdgeId next_outgoing(HalfEdgeId h) const
+        {
+            return twins_[prev(h)];
+        }
+
+        /**
+         * @brief Returns the boundary half-edge that follows @a h along
+         *  the boundary, i.e. the one that starts at @a h's destination.
+         *
+         * @a h must be a boundary half-edge.
+         */
+        [[nodiscard]] HalfEdgeId next_boundary(HalfEdgeId h) const
+        {
+            // Turn around the destination, from face to face, until the
+            // boundary is reached.
+            const auto start = next(h);
+            auto g = start;
+            while (twins_[g] != INVALID_HALF_EDGE_ID)
+            {
+                g = next(twins_[g]);
+                if (g == start)
+                    return INVALID_HALF_EDGE_ID;
+            }
+            return g;
+        }
+
+        /**
+         * @brief Returns the half-edges that start at @a v, one per face
+         *  around it.
+         */
+        [[nodiscard]] HalfEdgeRange outgoing_half_edges(VertexId v) const
+        {
+            return {*this,
+                    [](const HalfEdgeMesh& m, HalfEdgeId h)
+                    {
+                        return m.next_outgoing(h);
+                    },
+                    vertex_half_edges_[v]};
+        }
+
+        /**
+         * @brief Returns the vertexes that share an edge with @a v.
+         */
+        [[nodiscard]] VertexNeighborRange vertex_neighbors(VertexId v) const
+        {
+            return {*this, vertex_half_edges_[v]};
+        }
+
+        /**
+         * @brief Returns the faces that share an edge with face @a f, in
+         *  the order of its half-edges, with INVALID_FACE_ID for edges on
+         *  the boundary.
+         */
+        [[nodiscard]] std::array<FaceId, 3> face_neighbors(FaceId f) const
+        {
+            std::array<FaceId, 3> result;
+            for (unsigned i = 0; i < 3; ++i)
+            {
+                const auto t = twins_[half_edge(f, i)];
+                result[i] = t == INVALID_HALF_EDGE_ID ? INVALID_FACE_ID : face(t);
+            }
+            return result;
+        }
+
+        /**
+         * @brief Returns the boundary half-edges of the hole or outer
+         *  boundary that the boundary half-edge @a h is part of, starting
+         *  with @a h.
+         */
+        [[nodiscard]] HalfEdgeRange boundary_loop(HalfEdgeId h) const
+        {
+            return {*this,
+                    [](const HalfEdgeMesh& m, HalfEdgeId g)
+                    {
+                        return m.next_boundary(g);
+                    },
+                    h};
+        }
+
+    private:
+        static uint64_t get_edge_hash(uint64_t key)
+        {
+            // The mixing function from splitmix64.
+            key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ull;
+            key = (key ^ (key >> 27)) * 0x94D049BB133111EBull;
+            return key ^ (key >> 31);
+        }
+
+        void connect_twins()
+        {
+            const auto count = origins_.size();
+            if (count == 0)
+                return;
+
+            // An open-addressing hash table of directed edges, with load
+            // factor at most 0.5. Each slot holds the half-edge, the
+            // directed edge is found from its origin and destination.
+            const size_t table_size = std::bit_ceil(count * 2);
+            const size_t mask = table_size - 1;
+            std::vector<HalfEdgeId> table(table_size, INVALID_HALF_EDGE_ID);
+            auto get_key = [](VertexId a, VertexId b)
+            {
+                return uint64_t(a) << 32 | b;
+            };
+
+            for (HalfEdgeId h = 0; h < count; ++h)
+            {
+                const auto a = origin(h);
+                const auto b = destination(h);
+
+                // Look for the opposite edge first.
+                auto slot = get_edge_hash(get_key(b, a)) & mask;
+                for (auto e = table[slot]; e != INVALID_HALF_EDGE_ID;
+                     e = table[slot])
+                {
+                    if (origin(e) == b && destination(e) == a)
+                    {
+                        if (twins_[e] == INVALID_HALF_EDGE_ID)
+                        {
+                            twins_[e] = h;
+                            twins_[h] = e;
+                        }
+                        break;
+                    }
+                    slot = (slot + 1) & mask;
+                }
+
+                slot = get_edge_hash(get_key(a, b)) & mask;
+                while (table[slot] != INVALID_HALF_EDGE_ID
+                       && (origin(table[slot]) != a
+                           || destination(table[slot]) != b))
+                {
+                    slot = (slot + 1) & mask;
+                }
+                // Only the first of several half-edges in the same
+                // direction is added, the others stay on the boundary.
+                if (table[slot] == INVALID_HALF_EDGE_ID)
+                    table[slot] = h;
+
+                if (vertex_half_edges_[a] == INVALID_HALF_EDGE_ID)
+                    vertex_half_edges_[a] = h;
+            }
+
+            // Make the boundary half-edges the vertexes' first half-edges,
+            // so that turning around a vertex covers all its faces.
+            for (HalfEdgeId h = 0; h < count; ++h)
+            {
+                if (twins_[h] == INVALID_HALF_EDGE_ID)
+                    vertex_half_edges_[origin(h)] = h;
+            }
+        }
+
+        std::vector<VertexId> origins_;
+        std::vector<HalfEdgeId> twins_;
+        std::vector<HalfEdgeId> vertex_half_edges_;
+    };
+
+    inline VertexNeighborRange::iterator::iterator(const HalfEdgeMesh* mesh,
+                                                   HalfEdgeId first)
+        : mesh_(mesh), first_(first), current_(first)
+    {}
+
+    inline VertexId VertexNeighborRange::iterator::operator*() const
+    {
+        if (incoming_ != INVALID_HALF_EDGE_ID)
+            return mesh_->origin(incoming_);
+        return mesh_->destination(current_);
+    }
+
+    inline VertexNeighborRange::iterator&
+    VertexNeighborRange::iterator::operator++()
+    {
+        if (incoming_ != INVALID_HALF_EDGE_ID)
+        {
+            incoming_ = INVALID_HALF_EDGE_ID;
+            current_ = INVALID_HALF_EDGE_ID;
+            return *this;
+        }
+
+        const auto next = mesh_->next_outgoing(current_);
+        if (next == INVALID_HALF_EDGE_ID)
+        {
+            // The last face before the boundary, its incoming half-edge
+            // leads to one more neighbor.
+            incoming_ = HalfEdgeMesh::prev(current_);
+        }
+        else
+        {
+            current_ = next == first_ ? INVALID_HALF_EDGE_ID : next;
+        }
+        return *this;
+    }
+}
@@ -0,0 +1,243 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <concepts>
+#include <type_traits>
+#include <vector>
+
+#include "BuildMesh.hpp"
+#include "Primitives.hpp"
+#include "Xyz/Parallel.hpp"
+#include "Xyz/SimplexNoise.hpp"
+
+namespace Xyz
+{
+    /**
+     * @brief A grid of height samples over a rectangle.
+     *
+     * The heights are offsets along the rectangle's normal. Vertex (i, j)
+     * is at (i * size.x / columns, j * size.y / rows) in the rectangle's
+     * coordinate system.
+     */
+    template <std::floating_point T>
+    struct Heightfield
+    {
+        OrientedRectangle<T, 3> rectangle;
+        unsigned columns = 1;
+        unsigned rows = 1;
+    };
+
+    template <std::floating_point T>
+    [[nodiscard]]
+    MeshSize predict_mesh_size(const Heightfield<T>& field)
+    {
+        Details::check_segments(field.columns, 1, "columns must be at least 1.");
+        Details::check_segments(field.rows, 1, "rows must be at least 1.");
+        const size_t columns = field.columns;
+        const size_t rows = field.rows;
+        return {(columns + 1) * (rows + 1), 6 * columns * rows};
+    }
+
+    /**
+     * @brief A height function for heightfields that samples a SimplexNoise
+     *  generator.
+     *
+     * Point (x, y) in the heightfield's rectangle is sampled at
+     * ((x, y) + offset) * frequency. Heightfields that are placed next to
+     * each other fit together if their offsets differ by the distance
+     * between their origins.
+     */
+    template <std::floating_point T>
+    struct NoiseHeight
+    {
+        const SimplexNoise* noise = nullptr;
+        Vector<T, 2> offset;
+        T frequency = 1;
+        T amplitude = 1;
+        int octaves = 1;
+        double persistence = 0.5;
+        /// The slice of the three-dimensional noise that is sampled.
+        double z = 0;
+
+        T operator()(T x, T y) const
+        {
+            return amplitude * T(noise->simplex(double((x + offset[0]) * frequency),
+                                                double((y + offset[1]) * frequency),
+                                                z, octaves, persistence));
+        }
+    };
+
+    /**
+     * @brief Builds a mesh for a Heightfield, with @a height(x, y) giving
+     *  the height at point (x, y) in the rectangle's coordinate system.
+     *
+     * All vertexes are shared by the quads around them. The normals and
+     * tangents are computed with central differences, and the samples
+     * just outside the rectangle are taken from @a height as well, so the
+     * normals along the edges match those of an adjacent heightfield with
+     * the same height function.
+     *
+     * The grid's rows of vertexes are split into chunks that are built in
+     * parallel directly into their final positions in the buffers. Each
+     * chunk samples the height function once per vertex, plus one row of
+     * samples above and below the chunk, so the result doesn't depend on
+     * the number of threads.
+     *
+     * @param height A function that returns the height at (x, y). It is
+     *  called concurrently by several threads if @a thread_count isn't 1.
+     * @param tex_rect The part of the texture that is mapped onto the
+     *  whole rectangle. If not provided, all texture coordinates are (0, 0).
+     * @param thread_count The number of threads to use, 0 means the number
+     *  of hardware threads.
+     */
+    template <ResizableBuffer BufferType,
+        std::floating_point ValueType,
+        std::integral IndexType,
+        typename HeightFunc,
+        typename... Encodings>
+        requires std::is_invocable_r_v<ValueType, const HeightFunc&,
+                                       ValueType, ValueType>
+    void build_mesh(MeshBuilder<BufferType, ValueType, IndexType, Encodings...>& builder,
+                    const Heightfield<ValueType>& field,
+                    const HeightFunc& height,
+                    const Rectangle<ValueType>& tex_rect = {},
+                    std::type_identity_t<IndexType> base_index = {},
+                    unsigned thread_count = 1)
+    {
+        using T = ValueType;
+        const auto size = predict_mesh_size(field);
+        const size_t columns = field.columns;
+        const size_t rows = field.rows;
+        const auto dx = field.rectangle.size[0] / T(columns);
+        const auto dy = field.rectangle.size[1] / T(rows);
+
+        // Grow the buffers once, and let each chunk fill in its own part.
+        const auto coord_row = builder.coords.size();
+        const auto normal_row = builder.normals ? builder.normals->size() : 0;
+        const auto tangent_row = builder.tangents ? builder.tangents->size() : 0;
+        const auto tex_coord_row = builder.tex_coords ? builder.tex_coords->size() : 0;
+        builder.coords.resize(coord_row + size.vertexes);
+        if (builder.normals)
+            builder.normals->resize(normal_row + size.vertexes);
+        if (builder.tangents)
+            builder.tangents->resize(tangent_row + size.vertexes);
+        if (builder.tex_coords)
+            builder.tex_coords->resize(tex_coord_row + size.vertexes);
+
+        auto& index_buffer = builder.indexes.buffer();
+        const auto first_index = index_buffer.size();
+        index_buffer.resize(first_index + size.indexes);
+        const auto index_base = IndexType(builder.indexes.base_index()
+                                          + base_index);
+
+        Details::parallel_for(
+            rows + 1, thread_count, std::max<size_t>(1, 4096 / (columns + 1)),
+            [&](size_t, size_t begin, size_t end)
+            {
+                const auto first_vertex = begin * (columns + 1);
+                MeshBuilder<BufferType, ValueType, IndexType, Encodings...> sub_builder{
+                    .indexes = builder.indexes,
+                    .coords = MeshAttributeBuilder<Vector<T, 3>, BufferType>(
+                        builder.coords.buffer(),
+                        builder.coords.stride(),
+                        builder.coords.offset(),
+                        coord_row + first_vertex),
+                    .normals = Details::make_sub_builder(
+                        builder.normals, normal_row + first_vertex),
+                    .tangents = Details::make_sub_builder(
+                        builder.tangents, tangent_row + first_vertex),
+                    .tex_coords = Details::make_sub_builder(
+                        builder.tex_coords, tex_coord_row + first_vertex)
+                };
+                Details::PrimitiveWriter writer(sub_builder,
+                                                field.rectangle.placement,
+                                                tex_rect, base_index);
+
+                // Three rows of samples, each with one extra sample on
+                // either side.
+                const auto width = columns + 3;
+                std::vector<T> samples(3 * width);
+                auto sample_row = [&](T* row, size_t j)
+                {
+                    const auto y = (T(j) - 1) * dy;
+                    for (size_t i = 0; i < width; ++i)
+                        row[i] = height((T(i) - 1) * dx, y);
+                };
+                T* below = samples.data();
+                T* current = below + width;
+                T* above = current + width;
+                // Row j of samples is vertex row j - 1.
+                sample_row(below, begin);
+                sample_row(current, begin + 1);
+
+                for (size_t j = begin; j < end; ++j)
+                {
+                    sample_row(above, j + 2);
+                    const auto v = T(j) / T(rows);
+                    for (size_t i = 0; i <= columns; ++i)
+                    {
+                        const auto dh_dx = (current[i + 2] - current[i])
+                                           / (2 * dx);
+                        const auto dh_dy = (above[i + 1] - below[i + 1])
+                                           / (2 * dy);
+                        writer.add_vertex(
+                            {T(i) * dx, T(j) * dy, current[i + 1]},
+                            normalize(Vector<T, 3>(-dh_dx, -dh_dy, 1)),
+                            normalize(Vector<T, 3>(1, 0, dh_dx)),
+                            1, T(i) / T(columns), v);
+                    }
+                    std::swap(below, current);
+                    std::swap(current, above);
+                }
+
+                // The quads between vertex rows j and j + 1 belong to the
+                // chunk with vertex row j.
+                auto* index = index_buffer.data() + first_index
+                              + 6 * columns * begin;
+                for (size_t j = begin; j < std::min(end, rows); ++j)
+                {
+                    for (size_t i = 0; i < columns; ++i)
+                    {
+                        const auto a = IndexType(index_base + j * (columns + 1) + i);
+                        const auto b = IndexType(a + 1);
+                        const auto c = IndexType(a + columns + 2);
+                        const auto d = IndexType(a + columns + 1);
+                        *index++ = a;
+                        *index++ = c;
+                        *index++ = d;
+                        *index++ = a;
+                        *index++ = b;
+                        *index++ = c;
+                    }
+                }
+            });
+    }
+
+    /**
+     * @brief Builds a mesh for a Heightfield with heights from a
+     *  SimplexNoise generator.
+     *
+     * Unlike the general overload, this one accepts a braced initializer,
+     * e.g. build_mesh(builder, field, {.noise = &noise, .amplitude = 5}).
+     */
+    template <ResizableBuffer BufferType,
+        std::floating_point ValueType,
+        std::integral IndexType,
+        typename... Encodings>
+    void build_mesh(MeshBuilder<BufferType, ValueType, IndexType, Encodings...>& builder,
+                    const Heightfield<ValueType>& field,
+                    const NoiseHeight<ValueType>& height,
+                    const Rectangle<ValueType>& tex_rect = {},
+                    std::type_identity_t<IndexType> base_index = {},
+                    unsigned thread_count = 1)
+    {
+        build_mesh<BufferType, ValueType, IndexType, NoiseHeight<ValueType>,
+                   Encodings...>(
+            builder, field, height, tex_rect, base_index, thread_count);
+    }
+}
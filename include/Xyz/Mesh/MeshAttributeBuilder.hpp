@@ -8,8 +8,10 @@
 #pragma once
 #include <cstring>
 #include <span>
+#include <stdexcept>
 #include <type_traits>
 
+#include "AttributeEncoding.hpp"
 #include "ResizableBuffer.hpp"
 
 namespace Xyz
@@ -18,10 +20,22 @@ namespace Xyz
     concept AssignableType = std::is_standard_layout_v<T>
         && std::is_trivially_copyable_v<T>;
 
-    template <AssignableType ValueType, ResizableBuffer BufferType>
+    /**
+     * @brief Writes values of type @a ValueType to every stride'th
+     *  position of a buffer.
+     *
+     * The values are converted with @a Encoding before they are written,
+     * e.g. to store normals as OctahedralEncoding or texture coordinates
+     * as HalfEncoding.
+     */
+    template <AssignableType ValueType,
+              ResizableBuffer BufferType,
+              AttributeEncoding<ValueType> Encoding = IdentityEncoding<ValueType>>
     class MeshAttributeBuilder
     {
     public:
+        using EncodedType = typename Encoding::EncodedType;
+
         MeshAttributeBuilder(BufferType& buffer,
                              size_t stride,
                              size_t offset = 0,
@@ -31,7 +45,7 @@ namespace Xyz
               stride_(stride),
               offset_(offset)
         {
-            if (sizeof(ValueType) > (stride - offset) * sizeof(typename BufferType::value_type))
+            if (sizeof(EncodedType) > (stride - offset) * sizeof(typename BufferType::value_type))
             {
                 throw std::invalid_argument(
                     "ValueType is too large for the given stride and offset.");
@@ -50,26 +64,59 @@ namespace Xyz
                 buffer_.resize(required_size);
         }
 
+        /**
+         * @brief Sets the number of rows to @a rows, growing the buffer if
+         *  necessary.
+         *
+         * New rows are left with whatever values the buffer already has
+         * there, and are meant to be filled by other builders that share
+         * the buffer, e.g. when a mesh is built by several threads.
+         */
+        void resize(size_t rows)
+        {
+            reserve(rows);
+            rows_ = rows;
+        }
+
+        [[nodiscard]] BufferType& buffer() const
+        {
+            return buffer_;
+        }
+
+        [[nodiscard]] size_t stride() const
+        {
+            return stride_;
+        }
+
+        [[nodiscard]] size_t offset() const
+        {
+            return offset_;
+        }
+
+        /**
+         * @brief Returns the decoded value in @a row.
+         */
         [[nodiscard]] ValueType get(size_t row) const
         {
-            ValueType value;
+            EncodedType value;
             auto ptr = reinterpret_cast<const char*>(buffer_.data());
             ptr += (row * stride_ + offset_)
                 * sizeof(typename BufferType::value_type);
-            memcpy(&value, ptr, sizeof(ValueType));
-            return value;
+            memcpy(&value, ptr, sizeof(EncodedType));
+            return Encoding::decode(value);
         }
 
         void add(const ValueType& value)
         {
             reserve(rows_ + 1);
-            set(rows_++, &value, sizeof(ValueType));
+            const auto encoded = Encoding::encode(value);
+            set(rows_++, &encoded, sizeof(EncodedType));
         }
 
         void add_n(const ValueType& value, size_t n)
         {
             reserve(rows_ + n);
-            set_n(rows_, value, n);
+            set_n(rows_, Encoding::encode(value), n);
             rows_ += n;
         }
 
@@ -82,14 +129,14 @@ namespace Xyz
             memcpy(ptr, bytes, size);
         }
 
-        void set_n(size_t first_row, const ValueType& value, size_t n)
+        void set_n(size_t first_row, const EncodedType& value, size_t n)
         {
             auto ptr = reinterpret_cast<char*>(buffer_.data());
             ptr += (first_row * stride_ + offset_)
                 * sizeof(typename BufferType::value_type);
             for (size_t i = 0; i < n; ++i)
             {
-                memcpy(ptr, &value, sizeof(ValueType));
+                memcpy(ptr, &value, sizeof(EncodedType));
                 ptr += stride_ * sizeof(typename BufferType::value_type);
             }
         }
@@ -6,6 +6,7 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #pragma once
+#include <algorithm>
 #include <cstdint>
 #include <optional>
 
@@ -15,10 +16,58 @@
 
 namespace Xyz
 {
+    /**
+     * @brief The number of vertexes and indexes in a mesh.
+     */
+    struct MeshSize
+    {
+        size_t vertexes = 0;
+        size_t indexes = 0;
+    };
+
+    constexpr MeshSize operator+(const MeshSize& a, const MeshSize& b)
+    {
+        return {a.vertexes + b.vertexes, a.indexes + b.indexes};
+    }
+
+    constexpr MeshSize& operator+=(MeshSize& a, const MeshSize& b)
+    {
+        a = a + b;
+        return a;
+    }
+
+    constexpr MeshSize operator*(const MeshSize& size, size_t n)
+    {
+        return {size.vertexes * n, size.indexes * n};
+    }
+
+    constexpr MeshSize operator*(size_t n, const MeshSize& size)
+    {
+        return size * n;
+    }
+
+    constexpr bool operator==(const MeshSize& a, const MeshSize& b)
+    {
+        return a.vertexes == b.vertexes && a.indexes == b.indexes;
+    }
+
+    /**
+     * @brief The index and attribute builders that build_mesh writes a
+     *  mesh to.
+     *
+     * The normals, tangents and texture coordinates can be stored in a
+     * more compact format than their ValueType vectors by choosing other
+     * encodings than IdentityEncoding, e.g. OctahedralEncoding,
+     * Snorm1010102Encoding and HalfEncoding respectively. The coordinates
+     * are always stored as they are.
+     */
     template <
         ResizableBuffer BufferType,
         std::floating_point ValueTypeT,
-        std::integral IndexTypeT = uint32_t>
+        std::integral IndexTypeT = uint32_t,
+        typename NormalEncoding = IdentityEncoding<Vector<ValueTypeT, 3>>,
+        typename TangentEncoding = IdentityEncoding<Vector<ValueTypeT, 4>>,
+        typename TexCoordEncoding = IdentityEncoding<Vector<ValueTypeT, 2>>>
     struct MeshBuilder
     {
         using ValueType = ValueTypeT;
@@ -28,10 +77,59 @@ namespace Xyz
         using Vector3 = Vector<ValueType, 3>;
         using Vector4 = Vector<ValueType, 4>;
 
+        using CoordBuilder = MeshAttributeBuilder<Vector3, BufferType>;
+        using NormalBuilder = MeshAttributeBuilder<Vector3, BufferType, NormalEncoding>;
+        using TangentBuilder = MeshAttributeBuilder<Vector4, BufferType, TangentEncoding>;
+        using TexCoordBuilder = MeshAttributeBuilder<Vector2, BufferType, TexCoordEncoding>;
+
         MeshIndexBuilder<IndexTypeT> indexes;
-        MeshAttributeBuilder<Vector3, BufferType> coords;
-        std::optional<MeshAttributeBuilder<Vector3, BufferType>> normals = {};
-        std::optional<MeshAttributeBuilder<Vector4, BufferType>> tangents = {};
-        std::optional<MeshAttributeBuilder<Vector2, BufferType>> tex_coords = {};
+        CoordBuilder coords;
+        std::optional<NormalBuilder> normals = {};
+        std::optional<TangentBuilder> tangents = {};
+        std::optional<TexCoordBuilder> tex_coords = {};
+
+        /**
+         * @brief Makes room for a total of @a count vertexes in every
+         *  attribute.
+         *
+         * Attributes that share an interleaved buffer only grow it once.
+         */
+        void reserve_vertexes(size_t count)
+        {
+            coords.reserve(count);
+            if (normals)
+                normals->reserve(count);
+            if (tangents)
+                tangents->reserve(count);
+            if (tex_coords)
+                tex_coords->reserve(count);
+        }
+
+        /**
+         * @brief Makes room for a total of @a count indexes.
+         */
+        void reserve_indexes(size_t count)
+        {
+            indexes.reserve(count);
+        }
+
+        /**
+         * @brief Makes room for @a size more vertexes and indexes, e.g. the
+         *  sum of predict_mesh_size for a number of shapes.
+         *
+         * Call this once before building many shapes into the same
+         * buffers, so that they are allocated once instead of growing
+         * incrementally. If it is called once per shape instead, the
+         * index buffer's capacity is at least doubled whenever it has to
+         * grow, so that the total cost stays linear.
+         */
+        void reserve(const MeshSize& size)
+        {
+            reserve_vertexes(coords.size() + size.vertexes);
+            const auto required = indexes.size() + size.indexes;
+            const auto capacity = indexes.buffer().capacity();
+            if (required > capacity)
+                reserve_indexes(std::max(required, 2 * capacity));
+        }
     };
 }
@@ -30,6 +30,16 @@ namespace Xyz
             buffer_.reserve(size);
         }
 
+        [[nodiscard]] std::vector<T>& buffer() const
+        {
+            return buffer_;
+        }
+
+        [[nodiscard]] T base_index() const
+        {
+            return base_index_;
+        }
+
         void add(T index)
         {
             buffer_.push_back(base_index_ + index);
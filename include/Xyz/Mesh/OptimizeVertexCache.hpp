@@ -0,0 +1,368 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "ResizableBuffer.hpp"
+
+namespace Xyz
+{
+    namespace Details
+    {
+        template <std::integral IndexType>
+        void check_triangle_indexes(const std::vector<IndexType>& indexes,
+                                    size_t vertex_count)
+        {
+            if (indexes.size() % 3 != 0)
+                throw std::invalid_argument(
+                    "The number of indexes is not a multiple of 3.");
+
+            for (const auto index : indexes)
+            {
+                if (std::cmp_less(index, 0)
+                    || std::cmp_greater_equal(index, vertex_count))
+                {
+                    throw std::invalid_argument("Index is out of range.");
+                }
+            }
+        }
+
+        /**
+         * @brief The vertex score in Tom Forsyth's "Linear-speed vertex
+         *  cache optimisation".
+         *
+         * Vertexes that were used by the most recent triangle get a fixed
+         * score, vertexes further back in the cache get gradually lower
+         * scores. Vertexes with few remaining triangles get a boost, which
+         * makes the algorithm finish off small patches rather than leave
+         * isolated triangles behind.
+         */
+        inline float get_forsyth_vertex_score(int cache_position,
+                                              unsigned remaining_triangles,
+                                              unsigned cache_size)
+        {
+            if (remaining_triangles == 0)
+                return -1;
+
+            float score = 0;
+            if (cache_position >= 0)
+            {
+                if (cache_position < 3)
+                {
+                    score = 0.75f;
+                }
+                else
+                {
+                    const auto scale = 1.0f / float(cache_size - 3);
+                    score = std::pow(
+                        1.0f - float(cache_position - 3) * scale, 1.5f);
+                }
+            }
+
+            return score + 2.0f / std::sqrt(float(remaining_triangles));
+        }
+    }
+
+    /**
+     * @brief Reorders the triangles in @a indexes to make better use of
+     *  the GPU's post-transform vertex cache.
+     *
+     * Uses Tom Forsyth's algorithm, which greedily picks the next triangle
+     * among those that use the vertexes in a simulated LRU cache. It runs in
+     * linear time and doesn't depend on the exact cache size of the
+     * hardware. The orientation of each triangle is preserved.
+     *
+     * @param indexes A triangle list, i.e. three indexes per triangle.
+     * @param vertex_count The number of vertexes @a indexes refers to.
+     * @param cache_size The size of the simulated cache. Must be at least 4.
+     * @throws std::invalid_argument if the number of indexes isn't a
+     *  multiple of 3, an index is out of range or @a cache_size is too
+     *  small.
+     */
+    template <std::integral IndexType>
+    void optimize_vertex_cache(std::vector<IndexType>& indexes,
+                               size_t vertex_count,
+                               unsigned cache_size = 32)
+    {
+        if (cache_size < 4)
+            throw std::invalid_argument("The cache size must be at least 4.");
+        Details::check_triangle_indexes(indexes, vertex_count);
+
+        const size_t triangle_count = indexes.size() / 3;
+        if (triangle_count == 0)
+            return;
+
+        // The live triangles of vertex v are
+        // adjacency[offsets[v], offsets[v] + remaining[v]).
+        std::vector<unsigned> remaining(vertex_count, 0);
+        for (const auto index : indexes)
+            ++remaining[size_t(index)];
+
+        std::vector<size_t> offsets(vertex_count + 1, 0);
+        for (size_t v = 0; v < vertex_count; ++v)
+            offsets[v + 1] = offsets[v] + remaining[v];
+
+        std::vector<size_t> adjacency(indexes.size());
+        {
+            std::vector<size_t> fill(offsets.begin(), offsets.end() - 1);
+            for (size_t i = 0; i < indexes.size(); ++i)
+                adjacency[fill[size_t(indexes[i])]++] = i / 3;
+        }
+
+        std::vector<int> cache_position(vertex_count, -1);
+        std::vector<float> vertex_score(vertex_count);
+        for (size_t v = 0; v < vertex_count; ++v)
+        {
+            vertex_score[v] = Details::get_forsyth_vertex_score(
+                -1, remaining[v], cache_size);
+        }
+
+        std::vector<float> triangle_score(triangle_count, 0);
+        for (size_t i = 0; i < indexes.size(); ++i)
+            triangle_score[i / 3] += vertex_score[size_t(indexes[i])];
+
+        constexpr auto NONE = std::numeric_limits<size_t>::max();
+        size_t best = 0;
+        for (size_t t = 1; t < triangle_count; ++t)
+        {
+            if (triangle_score[t] > triangle_score[best])
+                best = t;
+        }
+
+        std::vector<bool> emitted(triangle_count, false);
+        std::vector<IndexType> result;
+        result.reserve(indexes.size());
+        std::vector<size_t> cache, new_cache;
+        cache.reserve(cache_size + 3);
+        new_cache.reserve(cache_size + 3);
+        size_t next_unemitted = 0;
+
+        for (size_t n = 0; n < triangle_count; ++n)
+        {
+            if (best == NONE)
+            {
+                // The cache doesn't touch any remaining triangles, start
+                // over with the first triangle that hasn't been emitted.
+                while (emitted[next_unemitted])
+                    ++next_unemitted;
+                best = next_unemitted;
+            }
+
+            emitted[best] = true;
+            const size_t corners[3] = {size_t(indexes[3 * best]),
+                                       size_t(indexes[3 * best + 1]),
+                                       size_t(indexes[3 * best + 2])};
+
+            new_cache.clear();
+            for (const auto v : corners)
+            {
+                result.push_back(IndexType(v));
+
+                // Remove the triangle from the vertex' live triangles.
+                const auto begin = offsets[v];
+                const auto end = begin + remaining[v];
+                for (size_t i = begin; i < end; ++i)
+                {
+                    if (adjacency[i] == best)
+                    {
+                        std::swap(adjacency[i], adjacency[end - 1]);
+                        --remaining[v];
+                        break;
+                    }
+                }
+
+                if (std::find(new_cache.begin(), new_cache.end(), v)
+                    == new_cache.end())
+                {
+                    new_cache.push_back(v);
+                }
+            }
+
+            for (const auto v : cache)
+            {
+                if (v != corners[0] && v != corners[1] && v != corners[2])
+                    new_cache.push_back(v);
+            }
+
+            // Update the scores of every vertex whose position has changed,
+            // including those that just fell out of the cache, and of their
+            // remaining triangles.
+            for (size_t i = 0; i < new_cache.size(); ++i)
+            {
+                const auto v = new_cache[i];
+                cache_position[v] = i < cache_size ? int(i) : -1;
+                const auto score = Details::get_forsyth_vertex_score(
+                    cache_position[v], remaining[v], cache_size);
+                const auto delta = score - vertex_score[v];
+                vertex_score[v] = score;
+                const auto begin = offsets[v];
+                for (size_t j = begin; j < begin + remaining[v]; ++j)
+                    triangle_score[adjacency[j]] += delta;
+            }
+
+            if (new_cache.size() > cache_size)
+                new_cache.resize(cache_size);
+            std::swap(cache, new_cache);
+
+            best = NONE;
+            float best_score = -std::numeric_limits<float>::max();
+            for (const auto v : cache)
+            {
+                const auto begin = offsets[v];
+                for (size_t j = begin; j < begin + remaining[v]; ++j)
+                {
+                    const auto t = adjacency[j];
+                    if (triangle_score[t] > best_score)
+                    {
+                        best_score = triangle_score[t];
+                        best = t;
+                    }
+                }
+            }
+        }
+
+        indexes = std::move(result);
+    }
+
+    /**
+     * @brief Reorders the vertexes in @a buffer in the order they are first
+     *  used by @a indexes, and updates @a indexes accordingly.
+     *
+     * This improves the locality of the GPU's vertex fetches and should be
+     * done after optimize_vertex_cache. Vertexes that aren't used by any
+     * index are moved to the end of the buffer, in their original order.
+     *
+     * @param buffer An interleaved vertex buffer.
+     * @param stride The number of values per vertex in @a buffer.
+     * @param indexes The indexes into @a buffer. They are remapped in place.
+     * @return The number of vertexes that are used by @a indexes.
+     * @throws std::invalid_argument if @a stride is 0, the buffer size isn't
+     *  a multiple of @a stride, or an index is out of range.
+     */
+    template <ResizableBuffer BufferType, std::integral IndexType>
+    size_t optimize_vertex_fetch(BufferType& buffer,
+                                 size_t stride,
+                                 std::vector<IndexType>& indexes)
+    {
+        using T = typename BufferType::value_type;
+
+        if (stride == 0 || size_t(buffer.size()) % stride != 0)
+            throw std::invalid_argument("Invalid stride.");
+
+        const size_t count = size_t(buffer.size()) / stride;
+        constexpr auto UNUSED = std::numeric_limits<size_t>::max();
+        std::vector<size_t> remap(count, UNUSED);
+        size_t used = 0;
+        for (const auto index : indexes)
+        {
+            if (std::cmp_less(index, 0) || std::cmp_greater_equal(index, count))
+                throw std::invalid_argument("Index is out of range.");
+            if (remap[size_t(index)] == UNUSED)
+                remap[size_t(index)] = used++;
+        }
+
+        size_t next = used;
+        for (auto& pos : remap)
+        {
+            if (pos == UNUSED)
+                pos = next++;
+        }
+
+        T* data = buffer.data();
+        std::vector<T> copy(data, data + count * stride);
+        for (size_t i = 0; i < count; ++i)
+            memcpy(data + remap[i] * stride, copy.data() + i * stride,
+                   stride * sizeof(T));
+
+        for (auto& index : indexes)
+            index = IndexType(remap[size_t(index)]);
+
+        return used;
+    }
+
+    /**
+     * @brief Measurements of how well a triangle list uses a vertex cache.
+     */
+    struct VertexCacheStatistics
+    {
+        /**
+         * @brief The number of cache misses, i.e. vertex shader
+         *  invocations.
+         */
+        size_t transformed_vertexes = 0;
+        /**
+         * @brief Average cache miss ratio: transformed vertexes per
+         *  triangle. It is 3 when there is no reuse at all, and approaches
+         *  0.5 for large regular grids with an ideal ordering.
+         */
+        double acmr = 0;
+        /**
+         * @brief Average transformed vertex ratio: transformed vertexes per
+         *  used vertex. 1 is optimal. Unlike the ACMR, it doesn't depend on
+         *  the mesh's topology.
+         */
+        double atvr = 0;
+    };
+
+    /**
+     * @brief Simulates a FIFO post-transform vertex cache of size
+     *  @a cache_size and returns the number of cache misses for the
+     *  triangle list @a indexes.
+     *
+     * @throws std::invalid_argument if the number of indexes isn't a
+     *  multiple of 3 or an index is out of range.
+     */
+    template <std::integral IndexType>
+    [[nodiscard]]
+    VertexCacheStatistics
+    get_vertex_cache_statistics(const std::vector<IndexType>& indexes,
+                                size_t vertex_count,
+                                unsigned cache_size = 16)
+    {
+        Details::check_triangle_indexes(indexes, vertex_count);
+
+        VertexCacheStatistics result;
+        if (indexes.empty())
+            return result;
+
+        // A vertex is in the cache if fewer than cache_size vertexes have
+        // been added since it was added itself.
+        std::vector<size_t> timestamps(vertex_count, 0);
+        std::vector<bool> used(vertex_count, false);
+        size_t time = cache_size + 1;
+        size_t used_count = 0;
+        for (const auto index : indexes)
+        {
+            const auto v = size_t(index);
+            if (!used[v])
+            {
+                used[v] = true;
+                ++used_count;
+            }
+
+            if (time - timestamps[v] > cache_size)
+            {
+                timestamps[v] = time++;
+                ++result.transformed_vertexes;
+            }
+        }
+
+        const auto triangles = double(indexes.size() / 3);
+        result.acmr = double(result.transformed_vertexes) / triangles;
+        result.atvr = double(result.transformed_vertexes) / double(used_count);
+        return result;
+    }
+}
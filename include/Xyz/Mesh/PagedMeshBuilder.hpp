@@ -0,0 +1,287 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "MeshBuilder.hpp"
+
+namespace Xyz
+{
+    /**
+     * @brief The positions of a MeshBuilder's attributes in an interleaved
+     *  vertex buffer.
+     *
+     * All values are counted in elements of the buffer's value type.
+     * Attributes without an offset are not written.
+     */
+    struct VertexLayout
+    {
+        size_t stride = 3;
+        size_t coords = 0;
+        std::optional<size_t> normals = {};
+        std::optional<size_t> tangents = {};
+        std::optional<size_t> tex_coords = {};
+    };
+
+    /**
+     * @brief A part of a mesh that is handed to the sink of a
+     *  PagedMeshBuilder.
+     *
+     * The indexes are relative to the page's first vertex, so each page
+     * is a complete mesh in itself.
+     */
+    template <typename BufferValueType, std::integral IndexType>
+    struct MeshPage
+    {
+        /// The interleaved vertexes, VertexLayout::stride values each.
+        std::span<const BufferValueType> vertexes;
+        std::span<const IndexType> indexes;
+        /// The number of vertexes in all the preceding pages.
+        size_t first_vertex = 0;
+        /// The number of indexes in all the preceding pages.
+        size_t first_index = 0;
+    };
+
+    /**
+     * @brief Builds a mesh in fixed-size pages that are handed to a sink
+     *  as soon as they are full, rather than in a single buffer that
+     *  holds the whole mesh.
+     *
+     * The page buffers are allocated once and reused, so building a large
+     * mesh needs neither repeated reallocation of one huge buffer nor
+     * memory for more than one page. Each shape's vertexes and indexes are
+     * always in the same page: if a shape doesn't fit in what's left of
+     * the current page, the page is sent to the sink first. A shape that
+     * is larger than a whole page gets a page of its own, which grows the
+     * page buffers.
+     *
+     * Indexes are relative to the start of each page, which means that
+     * IndexType can be as small as uint16_t if the pages have at most
+     * 65536 vertexes.
+     *
+     * Call flush after the last shape to send the final page to the sink.
+     *
+     * @a Encodings are the MeshBuilder's attribute encodings.
+     */
+    template <ResizableBuffer BufferType,
+              std::floating_point ValueType,
+              std::integral IndexType = uint32_t,
+              typename... Encodings>
+    class PagedMeshBuilder
+    {
+    public:
+        using Builder = MeshBuilder<BufferType, ValueType, IndexType, Encodings...>;
+        using Page = MeshPage<typename BufferType::value_type, IndexType>;
+        using Sink = std::function<void(const Page&)>;
+
+        /**
+         * @param layout Where each attribute goes in the vertex buffer.
+         * @param page_size The maximum number of vertexes and indexes in
+         *  a page, unless a single shape needs more.
+         * @param sink The function that receives each page. The page's
+         *  memory is reused once the sink returns.
+         * @throws std::invalid_argument if either page size is 0, the
+         *  page has more vertexes than IndexType can address, or @a sink
+         *  is empty.
+         */
+        PagedMeshBuilder(const VertexLayout& layout,
+                         const MeshSize& page_size,
+                         Sink sink)
+            : layout_(layout),
+              page_size_(page_size),
+              sink_(std::move(sink))
+        {
+            if (page_size.vertexes == 0 || page_size.indexes == 0)
+                throw std::invalid_argument("The page size can't be 0.");
+            if (std::cmp_greater(page_size.vertexes - 1,
+                                 std::numeric_limits<IndexType>::max()))
+            {
+                throw std::invalid_argument(
+                    "The page has too many vertexes for IndexType.");
+            }
+            if (!sink_)
+                throw std::invalid_argument("The sink is empty.");
+
+            vertexes_.resize(page_size.vertexes * layout.stride);
+            indexes_.reserve(page_size.indexes);
+            reset_builder();
+        }
+
+        /**
+         * @brief Calls @a build_func(builder, base_index) to add a mesh
+         *  with @a size vertexes and indexes to the current page.
+         *
+         * @a base_index is the number of vertexes already in the page, and
+         * must be added to every index, like the base_index argument to
+         * build_mesh.
+         *
+         * @throws std::logic_error if the number of vertexes or indexes
+         *  build_func added doesn't match @a size.
+         */
+        template <typename BuildFunc>
+        void add(const MeshSize& size, BuildFunc&& build_func)
+        {
+            const auto vertex_count = builder_->coords.size();
+            if (vertex_count + size.vertexes > page_size_.vertexes
+                || indexes_.size() + size.indexes > page_size_.indexes)
+            {
+                flush();
+            }
+
+            const auto first_vertex = builder_->coords.size();
+            const auto first_index = indexes_.size();
+            if (first_vertex + size.vertexes > size_t(vertexes_.size()) / layout_.stride)
+            {
+                // The shape doesn't fit in an empty page.
+                if (std::cmp_greater(size.vertexes - 1,
+                                     std::numeric_limits<IndexType>::max()))
+                {
+                    throw std::invalid_argument(
+                        "The mesh has too many vertexes for IndexType.");
+                }
+                builder_->reserve_vertexes(size.vertexes);
+            }
+
+            build_func(*builder_, IndexType(first_vertex));
+
+            if (builder_->coords.size() != first_vertex + size.vertexes
+                || indexes_.size() != first_index + size.indexes)
+            {
+                throw std::logic_error(
+                    "The mesh size doesn't match the given size.");
+            }
+        }
+
+        /**
+         * @brief Builds the mesh for @a shape in the current page.
+         *
+         * The size is given by predict_mesh_size(shape), and the mesh is
+         * built by build_mesh(builder, shape, tex_arg, base_index).
+         */
+        template <typename Shape, typename TexArg>
+        void add(const Shape& shape, const TexArg& tex_arg)
+        {
+            add(predict_mesh_size(shape),
+                [&](Builder& builder, IndexType base_index)
+                {
+                    build_mesh(builder, shape, tex_arg, base_index);
+                });
+        }
+
+        /**
+         * @brief Builds the mesh for @a shape with default texture
+         *  coordinates in the current page.
+         */
+        template <typename Shape>
+        void add(const Shape& shape)
+        {
+            add(predict_mesh_size(shape),
+                [&](Builder& builder, IndexType base_index)
+                {
+                    build_mesh(builder, shape, {}, base_index);
+                });
+        }
+
+        /**
+         * @brief Sends the current page to the sink, unless it is empty,
+         *  and starts a new one.
+         */
+        void flush()
+        {
+            const auto vertex_count = builder_->coords.size();
+            if (vertex_count == 0 && indexes_.empty())
+                return;
+
+            const Page page{
+                .vertexes = {vertexes_.data(), vertex_count * layout_.stride},
+                .indexes = indexes_,
+                .first_vertex = vertex_count_,
+                .first_index = index_count_
+            };
+            sink_(page);
+
+            vertex_count_ += vertex_count;
+            index_count_ += indexes_.size();
+            ++page_count_;
+            indexes_.clear();
+            reset_builder();
+        }
+
+        /**
+         * @brief The number of vertexes in all pages, including the
+         *  current one.
+         */
+        [[nodiscard]] size_t vertex_count() const
+        {
+            return vertex_count_ + builder_->coords.size();
+        }
+
+        /**
+         * @brief The number of indexes in all pages, including the
+         *  current one.
+         */
+        [[nodiscard]] size_t index_count() const
+        {
+            return index_count_ + indexes_.size();
+        }
+
+        /**
+         * @brief The number of pages that have been sent to the sink.
+         */
+        [[nodiscard]] size_t page_count() const
+        {
+            return page_count_;
+        }
+
+    private:
+        template <typename AttributeBuilder>
+        std::optional<AttributeBuilder>
+        make_attribute_builder(const std::optional<size_t>& offset)
+        {
+            if (!offset)
+                return {};
+            return AttributeBuilder(vertexes_, layout_.stride, *offset);
+        }
+
+        void reset_builder()
+        {
+            // The attribute builders can't be reassigned, as they hold
+            // references to the buffer.
+            builder_.reset();
+            builder_.emplace(Builder{
+                .indexes = MeshIndexBuilder<IndexType>(indexes_),
+                .coords = typename Builder::CoordBuilder(
+                    vertexes_, layout_.stride, layout_.coords),
+                .normals = make_attribute_builder<typename Builder::NormalBuilder>(
+                    layout_.normals),
+                .tangents = make_attribute_builder<typename Builder::TangentBuilder>(
+                    layout_.tangents),
+                .tex_coords = make_attribute_builder<typename Builder::TexCoordBuilder>(
+                    layout_.tex_coords)
+            });
+        }
+
+        VertexLayout layout_;
+        MeshSize page_size_;
+        Sink sink_;
+        BufferType vertexes_;
+        std::vector<IndexType> indexes_;
+        std::optional<Builder> builder_;
+        size_t vertex_count_ = 0;
+        size_t index_count_ = 0;
+        size_t page_count_ = 0;
+    };
+}
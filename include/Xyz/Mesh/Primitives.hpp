@@ -0,0 +1,777 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "MeshBuilder.hpp"
+#include "Xyz/Constants.hpp"
+#include "Xyz/OrientedRectangle.hpp"
+#include "Xyz/Placement.hpp"
+#include "Xyz/Rectangle.hpp"
+
+namespace Xyz
+{
+    /**
+     * @brief A sphere that is tessellated along lines of latitude and
+     *  longitude.
+     *
+     * The poles are on the placement's z-axis, and the texture's u
+     * coordinate goes counterclockwise around it, starting at the x-axis.
+     * The v coordinate goes from the south pole to the north pole.
+     */
+    template <std::floating_point T>
+    struct UvSphere
+    {
+        Placement<T, 3> placement; ///< The origin is the center.
+        T radius = 1;
+        unsigned slices = 32; ///< The number of segments around the z-axis.
+        unsigned stacks = 16; ///< The number of segments from pole to pole.
+    };
+
+    /**
+     * @brief A sphere that is tessellated by subdividing the faces of an
+     *  icosahedron.
+     *
+     * The triangles are much more evenly sized than those of a UvSphere.
+     * Each face has its own vertexes, which means that the texture
+     * coordinates can be corrected at the seam. They use the same mapping
+     * as UvSphere.
+     */
+    template <std::floating_point T>
+    struct IcoSphere
+    {
+        Placement<T, 3> placement; ///< The origin is the center.
+        T radius = 1;
+        /**
+         * @brief The number of segments each edge of the icosahedron is
+         *  split into. 1 gives the icosahedron itself.
+         */
+        unsigned segments = 4;
+    };
+
+    /**
+     * @brief A cylinder along the placement's z-axis, optionally with caps.
+     *
+     * The side's texture coordinates go counterclockwise around the z-axis
+     * (u) and from the bottom to the top (v). The caps are mapped onto the
+     * whole texture rectangle as seen from outside the cylinder.
+     */
+    template <std::floating_point T>
+    struct Cylinder
+    {
+        Placement<T, 3> placement; ///< The origin is the center of the bottom.
+        T radius = 1;
+        T height = 1;
+        unsigned slices = 32;
+        bool caps = true;
+    };
+
+    /**
+     * @brief A cone along the placement's z-axis, optionally with a
+     *  bottom cap.
+     *
+     * The texture coordinates are the same as for a Cylinder.
+     */
+    template <std::floating_point T>
+    struct Cone
+    {
+        Placement<T, 3> placement; ///< The origin is the center of the bottom.
+        T radius = 1;
+        T height = 1;
+        unsigned slices = 32;
+        bool cap = true;
+    };
+
+    /**
+     * @brief A torus around the placement's z-axis.
+     *
+     * The texture's u coordinate goes counterclockwise around the z-axis,
+     * and the v coordinate goes around the tube, starting at the outside.
+     */
+    template <std::floating_point T>
+    struct Torus
+    {
+        Placement<T, 3> placement; ///< The origin is the center.
+        T major_radius = 1; ///< The distance from the center to the tube.
+        T minor_radius = T(0.25); ///< The radius of the tube.
+        unsigned major_segments = 48;
+        unsigned minor_segments = 24;
+    };
+
+    /**
+     * @brief A cylinder with hemispheres at both ends, along the
+     *  placement's z-axis.
+     *
+     * The texture coordinates are the same as for a UvSphere that has been
+     * split at the equator, with the v coordinate proportional to the
+     * distance along the surface.
+     */
+    template <std::floating_point T>
+    struct Capsule
+    {
+        /**
+         * @brief The origin is the center of the bottom hemisphere.
+         */
+        Placement<T, 3> placement;
+        T radius = 1;
+        T height = 1; ///< The distance between the centers of the hemispheres.
+        unsigned slices = 32;
+        unsigned stacks = 8; ///< The number of segments in each hemisphere.
+    };
+
+    /**
+     * @brief A rectangle that is subdivided into a grid of quads.
+     */
+    template <std::floating_point T>
+    struct GridPlane
+    {
+        OrientedRectangle<T, 3> rectangle;
+        unsigned columns = 1;
+        unsigned rows = 1;
+    };
+
+    namespace Details
+    {
+        inline void check_segments(unsigned segments, unsigned minimum,
+                                   const char* message)
+        {
+            if (segments < minimum)
+                throw std::invalid_argument(message);
+        }
+    }
+
+    template <std::floating_point T>
+    [[nodiscard]]
+    MeshSize predict_mesh_size(const UvSphere<T>& sphere)
+    {
+        Details::check_segments(sphere.slices, 3, "slices must be at least 3.");
+        Details::check_segments(sphere.stacks, 2, "stacks must be at least 2.");
+        const size_t slices = sphere.slices;
+        const size_t stacks = sphere.stacks;
+        return {(slices + 1) * (stacks + 1), 6 * slices * (stacks - 1)};
+    }
+
+    template <std::floating_point T>
+    [[nodiscard]]
+    MeshSize predict_mesh_size(const IcoSphere<T>& sphere)
+    {
+        Details::check_segments(sphere.segments, 1, "segments must be at least 1.");
+        const size_t n = sphere.segments;
+        return {20 * (n + 1) * (n + 2) / 2, 60 * n * n};
+    }
+
+    template <std::floating_point T>
+    [[nodiscard]]
+    MeshSize predict_mesh_size(const Cylinder<T>& cylinder)
+    {
+        Details::check_segments(cylinder.slices, 3, "slices must be at least 3.");
+        const size_t slices = cylinder.slices;
+        MeshSize result{2 * (slices + 1), 6 * slices};
+        if (cylinder.caps)
+            result += MeshSize{2 * (slices + 1), 6 * slices};
+        return result;
+    }
+
+    template <std::floating_point T>
+    [[nodiscard]]
+    MeshSize predict_mesh_size(const Cone<T>& cone)
+    {
+        Details::check_segments(cone.slices, 3, "slices must be at least 3.");
+        const size_t slices = cone.slices;
+        MeshSize result{2 * slices + 1, 3 * slices};
+        if (cone.cap)
+            result += MeshSize{slices + 1, 3 * slices};
+        return result;
+    }
+
+    template <std::floating_point T>
+    [[nodiscard]]
+    MeshSize predict_mesh_size(const Torus<T>& torus)
+    {
+        Details::check_segments(torus.major_segments, 3,
+                                "major_segments must be at least 3.");
+        Details::check_segments(torus.minor_segments, 3,
+                                "minor_segments must be at least 3.");
+        const size_t major = torus.major_segments;
+        const size_t minor = torus.minor_segments;
+        return {(major + 1) * (minor + 1), 6 * major * minor};
+    }
+
+    template <std::floating_point T>
+    [[nodiscard]]
+    MeshSize predict_mesh_size(const Capsule<T>& capsule)
+    {
+        Details::check_segments(capsule.slices, 3, "slices must be at least 3.");
+        Details::check_segments(capsule.stacks, 1, "stacks must be at least 1.");
+        const size_t slices = capsule.slices;
+        const size_t stacks = capsule.stacks;
+        return {(slices + 1) * 2 * (stacks + 1), 12 * slices * stacks};
+    }
+
+    template <std::floating_point T>
+    [[nodiscard]]
+    MeshSize predict_mesh_size(const GridPlane<T>& grid)
+    {
+        Details::check_segments(grid.columns, 1, "columns must be at least 1.");
+        Details::check_segments(grid.rows, 1, "rows must be at least 1.");
+        const size_t columns = grid.columns;
+        const size_t rows = grid.rows;
+        return {(columns + 1) * (rows + 1), 6 * columns * rows};
+    }
+
+    namespace Details
+    {
+        /**
+         * @brief Writes vertexes given in a shape's local coordinate system
+         *  to a MeshBuilder.
+         */
+        template <ResizableBuffer BufferType,
+            std::floating_point ValueType,
+            std::integral IndexType,
+            typename... Encodings>
+        class PrimitiveWriter
+        {
+        public:
+            using Vector2 = Vector<ValueType, 2>;
+            using Vector3 = Vector<ValueType, 3>;
+
+            PrimitiveWriter(MeshBuilder<BufferType, ValueType, IndexType, Encodings...>& builder,
+                            const Placement<ValueType, 3>& placement,
+                            const Rectangle<ValueType>& tex_rect,
+                            IndexType base_index)
+                : builder_(builder),
+                  origin_(placement.origin),
+                  tex_rect_(tex_rect),
+                  base_index_(base_index)
+            {
+                std::tie(x_, y_, z_) = get_vectors(placement.orientation);
+                // Mirrored texture axes flip the tangent and the
+                // handedness, see build_mesh for Pgram.
+                u_sign_ = tex_rect.size.x() < 0 ? ValueType(-1) : ValueType(1);
+                v_sign_ = tex_rect.size.y() < 0 ? ValueType(-1) : ValueType(1);
+            }
+
+            /**
+             * @brief Adds a vertex.
+             * @param pos The position in local coordinates.
+             * @param normal The unit normal in local coordinates.
+             * @param tangent The unit vector along increasing @a u.
+             * @param handedness 1 if the direction of increasing @a v is
+             *  cross(normal, tangent), otherwise -1.
+             * @param u, v The texture coordinates relative to the texture
+             *  rectangle, i.e. in the range [0, 1].
+             */
+            void add_vertex(const Vector3& pos,
+                            const Vector3& normal,
+                            const Vector3& tangent,
+                            ValueType handedness,
+                            ValueType u,
+                            ValueType v)
+            {
+                builder_.coords.add(origin_ + to_world(pos));
+                if (builder_.normals)
+                    builder_.normals->add(to_world(normal));
+                if (builder_.tangents)
+                {
+                    builder_.tangents->add(make_vector4(
+                        to_world(tangent) * u_sign_,
+                        handedness * u_sign_ * v_sign_));
+                }
+                if (builder_.tex_coords)
+                {
+                    builder_.tex_coords->add(
+                        tex_rect_.origin + Vector2(u, v) * tex_rect_.size);
+                }
+            }
+
+            void add_triangle(size_t i0, size_t i1, size_t i2)
+            {
+                builder_.indexes.add(IndexType(base_index_ + i0),
+                                     IndexType(base_index_ + i1),
+                                     IndexType(base_index_ + i2));
+            }
+
+            /**
+             * @brief Adds the two triangles of the quad i0, i1, i2, i3,
+             *  which must be counterclockwise as seen from the front.
+             */
+            void add_quad(size_t i0, size_t i1, size_t i2, size_t i3)
+            {
+                add_triangle(i0, i2, i3);
+                add_triangle(i0, i1, i2);
+            }
+
+            /**
+             * @brief Adds the triangles between consecutive rings of
+             *  @a ring_size vertexes, starting at @a first.
+             *
+             * Rings where all vertexes are at the same point, i.e. poles,
+             * get one triangle per segment rather than a degenerate quad.
+             */
+            void add_ring_quads(size_t first,
+                                size_t ring_size,
+                                size_t ring_count,
+                                bool first_is_pole,
+                                bool last_is_pole)
+            {
+                for (size_t j = 0; j + 1 < ring_count; ++j)
+                {
+                    const auto r0 = first + j * ring_size;
+                    const auto r1 = r0 + ring_size;
+                    for (size_t i = 0; i + 1 < ring_size; ++i)
+                    {
+                        if (j == 0 && first_is_pole)
+                            add_triangle(r0 + i, r1 + i + 1, r1 + i);
+                        else if (j + 2 == ring_count && last_is_pole)
+                            add_triangle(r0 + i, r0 + i + 1, r1 + i + 1);
+                        else
+                            add_quad(r0 + i, r0 + i + 1, r1 + i + 1, r1 + i);
+                    }
+                }
+            }
+
+            /**
+             * @brief Adds a flat disc in the plane z = @a z, facing up or
+             *  down.
+             */
+            void add_disc(ValueType radius, ValueType z, unsigned slices,
+                          bool up, size_t first)
+            {
+                const auto sign = up ? ValueType(1) : ValueType(-1);
+                const Vector3 normal(0, 0, sign);
+                const Vector3 tangent(1, 0, 0);
+                add_vertex({0, 0, z}, normal, tangent, 1,
+                           ValueType(0.5), ValueType(0.5));
+                for (unsigned i = 0; i < slices; ++i)
+                {
+                    const auto [c, s] = get_unit_circle_point(i, slices);
+                    // Seen from below, the disc is mirrored vertically.
+                    add_vertex({radius * c, radius * s, z}, normal, tangent, 1,
+                               (1 + c) / 2, (1 + sign * s) / 2);
+                }
+
+                for (unsigned i = 0; i < slices; ++i)
+                {
+                    const auto a = first + 1 + i;
+                    const auto b = first + 1 + (i + 1) % slices;
+                    if (up)
+                        add_triangle(first, a, b);
+                    else
+                        add_triangle(first, b, a);
+                }
+            }
+
+            static std::pair<ValueType, ValueType>
+            get_unit_circle_point(size_t i, size_t n)
+            {
+                if (i == 0 || i == n)
+                    return {ValueType(1), ValueType(0)};
+                const auto angle = 2 * Constants<ValueType>::PI
+                                   * ValueType(i) / ValueType(n);
+                return {std::cos(angle), std::sin(angle)};
+            }
+
+        private:
+            Vector3 to_world(const Vector3& v) const
+            {
+                return x_ * v[0] + y_ * v[1] + z_ * v[2];
+            }
+
+            MeshBuilder<BufferType, ValueType, IndexType, Encodings...>& builder_;
+            Vector3 origin_;
+            Vector3 x_, y_, z_;
+            Rectangle<ValueType> tex_rect_;
+            ValueType u_sign_ = 1;
+            ValueType v_sign_ = 1;
+            IndexType base_index_;
+        };
+
+        /**
+         * @brief Adds rings of vertexes on a surface of revolution around
+         *  the z-axis.
+         *
+         * Ring j has @a slices + 1 vertexes, the last one at the same
+         * position as the first but with u = 1. @a profile(j) must return
+         * the radius and z-coordinate of ring j, the angle of its normal
+         * relative to the xy-plane, and its v coordinate.
+         */
+        template <typename Writer, typename ProfileFunc>
+        void add_revolution_rings(Writer& writer,
+                                  unsigned slices,
+                                  size_t ring_count,
+                                  ProfileFunc profile)
+        {
+            using T = typename Writer::Vector3::ValueType;
+            for (size_t j = 0; j < ring_count; ++j)
+            {
+                const auto [radius, z, cos_lat, sin_lat, v] = profile(j);
+                for (unsigned i = 0; i <= slices; ++i)
+                {
+                    const auto [c, s] = Writer::get_unit_circle_point(i, slices);
+                    writer.add_vertex({radius * c, radius * s, z},
+                                      {cos_lat * c, cos_lat * s, sin_lat},
+                                      {-s, c, 0}, 1,
+                                      T(i) / T(slices), v);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Builds a mesh for a UvSphere.
+     * @param tex_rect The part of the texture that is mapped onto the
+     *  sphere. If not provided, all texture coordinates are (0, 0).
+     */
+    template <ResizableBuffer BufferType,
+        std::floating_point ValueType,
+        std::integral IndexType,
+        typename... Encodings>
+    void build_mesh(MeshBuilder<BufferType, ValueType, IndexType, Encodings...>& builder,
+                    const UvSphere<ValueType>& sphere,
+                    const Rectangle<ValueType>& tex_rect = {},
+                    std::type_identity_t<IndexType> base_index = {})
+    {
+        using T = ValueType;
+        builder.reserve(predict_mesh_size(sphere));
+        Details::PrimitiveWriter writer(builder, sphere.placement, tex_rect,
+                                        base_index);
+        Details::add_revolution_rings(
+            writer, sphere.slices, sphere.stacks + 1,
+            [&](size_t j)
+            {
+                const auto v = T(j) / T(sphere.stacks);
+                const auto lat = (v - T(0.5)) * Constants<T>::PI;
+                // Put the poles exactly on the z-axis.
+                const bool pole = j == 0 || j == sphere.stacks;
+                const auto cos_lat = pole ? T(0) : std::cos(lat);
+                const auto sin_lat = pole ? (j == 0 ? T(-1) : T(1))
+                                          : std::sin(lat);
+                return std::tuple(sphere.radius * cos_lat,
+                                  sphere.radius * sin_lat,
+                                  cos_lat, sin_lat, v);
+            });
+        writer.add_ring_quads(0, sphere.slices + 1, sphere.stacks + 1,
+                              true, true);
+    }
+
+    /**
+     * @brief Builds a mesh for an IcoSphere.
+     * @param tex_rect The part of the texture that is mapped onto the
+     *  sphere. If not provided, all texture coordinates are (0, 0).
+     */
+    template <ResizableBuffer BufferType,
+        std::floating_point ValueType,
+        std::integral IndexType,
+        typename... Encodings>
+    void build_mesh(MeshBuilder<BufferType, ValueType, IndexType, Encodings...>& builder,
+                    const IcoSphere<ValueType>& sphere,
+                    const Rectangle<ValueType>& tex_rect = {},
+                    std::type_identity_t<IndexType> base_index = {})
+    {
+        using T = ValueType;
+        using V = Vector<T, 3>;
+        builder.reserve(predict_mesh_size(sphere));
+        Details::PrimitiveWriter writer(builder, sphere.placement, tex_rect,
+                                        base_index);
+
+        // The corners of an icosahedron, and its faces counterclockwise as
+        // seen from outside.
+        const auto g = (1 + std::sqrt(T(5))) / 2;
+        const V corners[12] = {
+            {-1, g, 0}, {1, g, 0}, {-1, -g, 0}, {1, -g, 0},
+            {0, -1, g}, {0, 1, g}, {0, -1, -g}, {0, 1, -g},
+            {g, 0, -1}, {g, 0, 1}, {-g, 0, -1}, {-g, 0, 1}
+        };
+        constexpr unsigned faces[20][3] = {
+            {0, 11, 5}, {0, 5, 1}, {0, 1, 7}, {0, 7, 10}, {0, 10, 11},
+            {1, 5, 9}, {5, 11, 4}, {11, 10, 2}, {10, 7, 6}, {7, 1, 8},
+            {3, 9, 4}, {3, 4, 2}, {3, 2, 6}, {3, 6, 8}, {3, 8, 9},
+            {4, 9, 5}, {2, 4, 11}, {6, 2, 10}, {8, 6, 7}, {9, 8, 1}
+        };
+
+        constexpr auto PI = Constants<T>::PI;
+        const size_t n = sphere.segments;
+        const size_t face_size = (n + 1) * (n + 2) / 2;
+        for (size_t f = 0; f < 20; ++f)
+        {
+            const auto& a = corners[faces[f][0]];
+            const auto& b = corners[faces[f][1]];
+            const auto& c = corners[faces[f][2]];
+            const auto center = normalize(a + b + c);
+            const auto center_u = std::atan2(center[1], center[0]) / (2 * PI)
+                                  + T(0.5);
+
+            // Row i has i + 1 vertexes, going from a (i = 0) to the edge
+            // between b and c (i = n).
+            for (size_t i = 0; i <= n; ++i)
+            {
+                for (size_t j = 0; j <= i; ++j)
+                {
+                    const auto normal = normalize(
+                        a * (T(n - i) / T(n)) + b * (T(i - j) / T(n))
+                        + c * (T(j) / T(n)));
+                    const auto horizontal = std::hypot(normal[0], normal[1]);
+                    auto u = center_u;
+                    Vector<T, 2> dir(-std::sin((center_u - T(0.5)) * 2 * PI),
+                                     std::cos((center_u - T(0.5)) * 2 * PI));
+                    if (horizontal > T(1e-6))
+                    {
+                        u = std::atan2(normal[1], normal[0]) / (2 * PI) + T(0.5);
+                        // Keep the face's texture coordinates together
+                        // where it crosses the seam.
+                        if (u - center_u > T(0.5))
+                            u -= 1;
+                        else if (center_u - u > T(0.5))
+                            u += 1;
+                        dir = {-normal[1] / horizontal, normal[0] / horizontal};
+                    }
+                    const auto v = std::asin(std::clamp(normal[2], T(-1), T(1)))
+                                   / PI + T(0.5);
+                    writer.add_vertex(normal * sphere.radius, normal,
+                                      {dir[0], dir[1], 0}, 1, u, v);
+                }
+            }
+
+            const auto first = f * face_size;
+            for (size_t i = 0; i < n; ++i)
+            {
+                const auto row0 = first + i * (i + 1) / 2;
+                const auto row1 = first + (i + 1) * (i + 2) / 2;
+                for (size_t j = 0; j <= i; ++j)
+                {
+                    writer.add_triangle(row0 + j, row1 + j, row1 + j + 1);
+                    if (j < i)
+                        writer.add_triangle(row0 + j, row1 + j + 1, row0 + j + 1);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Builds a mesh for a Cylinder.
+     * @param tex_rect The part of the texture that is mapped onto the side
+     *  and each of the caps. If not provided, all texture coordinates are
+     *  (0, 0).
+     */
+    template <ResizableBuffer BufferType,
+        std::floating_point ValueType,
+        std::integral IndexType,
+        typename... Encodings>
+    void build_mesh(MeshBuilder<BufferType, ValueType, IndexType, Encodings...>& builder,
+                    const Cylinder<ValueType>& cylinder,
+                    const Rectangle<ValueType>& tex_rect = {},
+                    std::type_identity_t<IndexType> base_index = {})
+    {
+        using T = ValueType;
+        builder.reserve(predict_mesh_size(cylinder));
+        Details::PrimitiveWriter writer(builder, cylinder.placement, tex_rect,
+                                        base_index);
+        Details::add_revolution_rings(
+            writer, cylinder.slices, 2,
+            [&](size_t j)
+            {
+                return std::tuple(cylinder.radius, cylinder.height * T(j),
+                                  T(1), T(0), T(j));
+            });
+        writer.add_ring_quads(0, cylinder.slices + 1, 2, false, false);
+
+        if (cylinder.caps)
+        {
+            const size_t first = 2 * (cylinder.slices + 1);
+            writer.add_disc(cylinder.radius, 0, cylinder.slices, false, first);
+            writer.add_disc(cylinder.radius, cylinder.height, cylinder.slices,
+                            true, first + cylinder.slices + 1);
+        }
+    }
+
+    /**
+     * @brief Builds a mesh for a Cone.
+     *
+     * The apex has one vertex per slice, with the normal in the middle of
+     * the slice, so that the shading is smooth all the way to the apex.
+     *
+     * @param tex_rect The part of the texture that is mapped onto the side
+     *  and the cap. If not provided, all texture coordinates are (0, 0).
+     */
+    template <ResizableBuffer BufferType,
+        std::floating_point ValueType,
+        std::integral IndexType,
+        typename... Encodings>
+    void build_mesh(MeshBuilder<BufferType, ValueType, IndexType, Encodings...>& builder,
+                    const Cone<ValueType>& cone,
+                    const Rectangle<ValueType>& tex_rect = {},
+                    std::type_identity_t<IndexType> base_index = {})
+    {
+        using T = ValueType;
+        builder.reserve(predict_mesh_size(cone));
+        Details::PrimitiveWriter writer(builder, cone.placement, tex_rect,
+                                        base_index);
+
+        // The normal's angle relative to the xy-plane.
+        const auto slant = std::hypot(cone.radius, cone.height);
+        const auto cos_lat = cone.height / slant;
+        const auto sin_lat = cone.radius / slant;
+        Details::add_revolution_rings(
+            writer, cone.slices, 1,
+            [&](size_t)
+            {
+                return std::tuple(cone.radius, T(0), cos_lat, sin_lat, T(0));
+            });
+
+        const auto slices = cone.slices;
+        const auto first_apex = size_t(slices) + 1;
+        for (unsigned i = 0; i < slices; ++i)
+        {
+            const auto angle = 2 * Constants<T>::PI * (T(i) + T(0.5)) / T(slices);
+            const auto c = std::cos(angle);
+            const auto s = std::sin(angle);
+            writer.add_vertex({0, 0, cone.height},
+                              {cos_lat * c, cos_lat * s, sin_lat},
+                              {-s, c, 0}, 1,
+                              (T(i) + T(0.5)) / T(slices), 1);
+            writer.add_triangle(i, i + 1, first_apex + i);
+        }
+
+        if (cone.cap)
+            writer.add_disc(cone.radius, 0, slices, false, first_apex + slices);
+    }
+
+    /**
+     * @brief Builds a mesh for a Torus.
+     * @param tex_rect The part of the texture that is mapped onto the
+     *  torus. If not provided, all texture coordinates are (0, 0).
+     */
+    template <ResizableBuffer BufferType,
+        std::floating_point ValueType,
+        std::integral IndexType,
+        typename... Encodings>
+    void build_mesh(MeshBuilder<BufferType, ValueType, IndexType, Encodings...>& builder,
+                    const Torus<ValueType>& torus,
+                    const Rectangle<ValueType>& tex_rect = {},
+                    std::type_identity_t<IndexType> base_index = {})
+    {
+        using T = ValueType;
+        builder.reserve(predict_mesh_size(torus));
+        Details::PrimitiveWriter writer(builder, torus.placement, tex_rect,
+                                        base_index);
+
+        // Ring j goes around the z-axis at angle j around the tube,
+        // starting at the outside.
+        const auto major = torus.major_segments;
+        const auto minor = torus.minor_segments;
+        for (unsigned j = 0; j <= minor; ++j)
+        {
+            const auto [cos_lat, sin_lat] = writer.get_unit_circle_point(j, minor);
+            const auto radius = torus.major_radius + torus.minor_radius * cos_lat;
+            for (unsigned i = 0; i <= major; ++i)
+            {
+                const auto [c, s] = writer.get_unit_circle_point(i, major);
+                writer.add_vertex({radius * c, radius * s,
+                                   torus.minor_radius * sin_lat},
+                                  {cos_lat * c, cos_lat * s, sin_lat},
+                                  {-s, c, 0}, 1,
+                                  T(i) / T(major), T(j) / T(minor));
+            }
+        }
+        writer.add_ring_quads(0, major + 1, minor + 1, false, false);
+    }
+
+    /**
+     * @brief Builds a mesh for a Capsule.
+     * @param tex_rect The part of the texture that is mapped onto the
+     *  capsule. If not provided, all texture coordinates are (0, 0).
+     */
+    template <ResizableBuffer BufferType,
+        std::floating_point ValueType,
+        std::integral IndexType,
+        typename... Encodings>
+    void build_mesh(MeshBuilder<BufferType, ValueType, IndexType, Encodings...>& builder,
+                    const Capsule<ValueType>& capsule,
+                    const Rectangle<ValueType>& tex_rect = {},
+                    std::type_identity_t<IndexType> base_index = {})
+    {
+        using T = ValueType;
+        builder.reserve(predict_mesh_size(capsule));
+        Details::PrimitiveWriter writer(builder, capsule.placement, tex_rect,
+                                        base_index);
+
+        // Rings 0 to stacks are the bottom hemisphere, rings stacks + 1 to
+        // 2 * stacks + 1 the top one. The quads between the two
+        // hemispheres' equators make up the cylinder.
+        constexpr auto PI = Constants<T>::PI;
+        const auto stacks = capsule.stacks;
+        const auto length = PI * capsule.radius + capsule.height;
+        Details::add_revolution_rings(
+            writer, capsule.slices, 2 * (stacks + 1),
+            [&](size_t j)
+            {
+                const bool top = j > stacks;
+                const auto k = top ? j - stacks - 1 : j;
+                const auto lat = (top ? T(k) : T(k) - T(stacks))
+                                 * PI / (2 * T(stacks));
+                const auto cos_lat = k == (top ? stacks : 0) ? T(0)
+                                     : k == (top ? 0 : stacks) ? T(1)
+                                     : std::cos(lat);
+                const auto sin_lat = k == (top ? 0 : stacks) ? T(0)
+                                     : std::sin(lat);
+                const auto z = capsule.radius * sin_lat
+                               + (top ? capsule.height : T(0));
+                // The distance along the surface from the bottom pole.
+                const auto distance = capsule.radius * (lat + PI / 2)
+                                      + (top ? capsule.height : T(0));
+                return std::tuple(capsule.radius * cos_lat, z,
+                                  cos_lat, sin_lat, distance / length);
+            });
+        writer.add_ring_quads(0, capsule.slices + 1, 2 * (stacks + 1),
+                              true, true);
+    }
+
+    /**
+     * @brief Builds a mesh for a GridPlane.
+     *
+     * Every vertex is shared by all the quads it belongs to.
+     *
+     * @param tex_rect The part of the texture that is mapped onto the
+     *  whole rectangle. If not provided, all texture coordinates are (0, 0).
+     */
+    template <ResizableBuffer BufferType,
+        std::floating_point ValueType,
+        std::integral IndexType,
+        typename... Encodings>
+    void build_mesh(MeshBuilder<BufferType, ValueType, IndexType, Encodings...>& builder,
+                    const GridPlane<ValueType>& grid,
+                    const Rectangle<ValueType>& tex_rect = {},
+                    std::type_identity_t<IndexType> base_index = {})
+    {
+        using T = ValueType;
+        builder.reserve(predict_mesh_size(grid));
+        const auto& rect = grid.rectangle;
+        Details::PrimitiveWriter writer(builder, rect.placement, tex_rect,
+                                        base_index);
+
+        // The rectangle is in the placement's xy-plane.
+        const auto columns = grid.columns;
+        const auto rows = grid.rows;
+        for (unsigned j = 0; j <= rows; ++j)
+        {
+            const auto v = T(j) / T(rows);
+            for (unsigned i = 0; i <= columns; ++i)
+            {
+                const auto u = T(i) / T(columns);
+                writer.add_vertex({u * rect.size[0], v * rect.size[1], 0},
+                                  {0, 0, 1}, {1, 0, 0}, 1, u, v);
+            }
+        }
+        writer.add_ring_quads(0, columns + 1, rows + 1, false, false);
+    }
+}
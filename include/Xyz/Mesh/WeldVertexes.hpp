@@ -0,0 +1,172 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "ResizableBuffer.hpp"
+
+namespace Xyz
+{
+    namespace Details
+    {
+        /**
+         * @brief Maps a buffer value to the value that is hashed and
+         *  compared when vertexes are welded.
+         *
+         * Floating point values are snapped to a grid with spacing
+         * @a epsilon if epsilon is positive. Negative zero becomes positive
+         * zero, so the two compare and hash the same.
+         */
+        template <typename T>
+        T quantize_weld_value(T value, T epsilon)
+        {
+            if constexpr (std::floating_point<T>)
+            {
+                if (epsilon > 0)
+                    value = std::floor(value / epsilon + T(0.5));
+                return value + T(0);
+            }
+            else
+            {
+                return value;
+            }
+        }
+
+        template <typename T>
+        uint64_t get_weld_hash(const T* row, size_t stride, T epsilon)
+        {
+            uint64_t hash = 0xCBF29CE484222325ull;
+            for (size_t i = 0; i < stride; ++i)
+            {
+                const auto value = quantize_weld_value(row[i], epsilon);
+                uint64_t bits = 0;
+                memcpy(&bits, &value, std::min(sizeof(value), sizeof(bits)));
+                // The mixing function from splitmix64.
+                hash += bits + 0x9E3779B97F4A7C15ull;
+                hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+                hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBull;
+                hash ^= hash >> 31;
+            }
+            return hash;
+        }
+
+        template <typename T>
+        bool are_weld_equal(const T* a, const T* b, size_t stride, T epsilon)
+        {
+            for (size_t i = 0; i < stride; ++i)
+            {
+                const auto qa = quantize_weld_value(a[i], epsilon);
+                const auto qb = quantize_weld_value(b[i], epsilon);
+                if (memcmp(&qa, &qb, sizeof(T)) != 0)
+                    return false;
+            }
+            return true;
+        }
+    }
+
+    /**
+     * @brief Removes duplicate vertexes from an interleaved vertex buffer
+     *  and updates @a indexes to refer to the remaining ones.
+     *
+     * Two vertexes are duplicates if all their attributes, i.e. all
+     * @a stride values in their rows, are equal. The first occurrence of
+     * each vertex is kept, and the remaining vertexes keep their relative
+     * order. The buffer is compacted in place and resized to the new
+     * number of vertexes.
+     *
+     * The vertexes are found with an open-addressing hash table, so the
+     * running time is linear in the number of vertexes and indexes.
+     *
+     * Any MeshAttributeBuilder that writes to @a buffer must be recreated
+     * with the new vertex count as its first row before it is used again.
+     *
+     * @param buffer The vertex buffer, typically the one shared by a
+     *  MeshBuilder's attribute builders.
+     * @param stride The number of values per vertex in @a buffer.
+     * @param indexes The indexes into @a buffer. They are remapped in place.
+     * @param epsilon If positive and the buffer's values are floating point
+     *  numbers, the values are snapped to a grid with this spacing before
+     *  they are compared. Values that are closer than epsilon can still end
+     *  up on either side of a grid line and not be welded. The vertexes that
+     *  are kept are not modified.
+     * @return The number of vertexes after welding.
+     * @throws std::invalid_argument if @a stride is 0, the buffer size isn't
+     *  a multiple of @a stride, or an index is out of range.
+     */
+    template <ResizableBuffer BufferType, std::integral IndexType>
+    size_t weld_vertexes(BufferType& buffer,
+                         size_t stride,
+                         std::vector<IndexType>& indexes,
+                         typename BufferType::value_type epsilon = {})
+    {
+        using T = typename BufferType::value_type;
+
+        if (stride == 0 || size_t(buffer.size()) % stride != 0)
+            throw std::invalid_argument("Invalid stride.");
+
+        const size_t count = size_t(buffer.size()) / stride;
+        for (const auto index : indexes)
+        {
+            if (std::cmp_less(index, 0) || std::cmp_greater_equal(index, count))
+                throw std::invalid_argument("Index is out of range.");
+        }
+
+        if (count == 0)
+            return 0;
+
+        // Load factor at most 0.5. The table stores the new position of
+        // each unique vertex plus one, 0 means the slot is empty.
+        const size_t table_size = std::bit_ceil(count * 2);
+        const size_t mask = table_size - 1;
+        std::vector<size_t> table(table_size, 0);
+        std::vector<IndexType> remap(count);
+
+        T* data = buffer.data();
+        size_t unique = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const T* row = data + i * stride;
+            auto slot = Details::get_weld_hash(row, stride, epsilon) & mask;
+            while (true)
+            {
+                const auto entry = table[slot];
+                if (entry == 0)
+                {
+                    if (unique != i)
+                        memmove(data + unique * stride, row, stride * sizeof(T));
+                    table[slot] = unique + 1;
+                    remap[i] = IndexType(unique++);
+                    break;
+                }
+
+                if (Details::are_weld_equal(data + (entry - 1) * stride,
+                                            row, stride, epsilon))
+                {
+                    remap[i] = IndexType(entry - 1);
+                    break;
+                }
+
+                slot = (slot + 1) & mask;
+            }
+        }
+
+        for (auto& index : indexes)
+            index = remap[size_t(index)];
+
+        buffer.resize(unique * stride);
+        return unique;
+    }
+}
@@ -7,8 +7,11 @@
 //****************************************************************************
 #pragma once
 #include <concepts>
+#include <span>
+#include <type_traits>
 #include "Quaternion.hpp"
 #include "RotationMatrix.hpp"
+#include "Trigonometry.hpp"
 #include "Utilities.hpp"
 
 namespace Xyz
@@ -46,14 +49,16 @@ namespace Xyz
     [[nodiscard]]
     Vector<T, 2> get_x_vector(const Orientation<T, 2>& o)
     {
-        return {std::cos(o.angle), std::sin(o.angle)};
+        const auto [s, c] = sincos(o.angle);
+        return {c, s};
     }
 
     template <std::floating_point T>
     [[nodiscard]]
     Vector<T, 2> get_y_vector(const Orientation<T, 2>& o)
     {
-        return {-std::sin(o.angle), std::cos(o.angle)};
+        const auto [s, c] = sincos(o.angle);
+        return {-s, c};
     }
 
     template <std::floating_point T>
@@ -61,8 +66,7 @@ namespace Xyz
     std::tuple<Vector<T, 2>, Vector<T, 2>>
     get_vectors(const Orientation<T, 2>& o)
     {
-        const auto c = std::cos(o.angle);
-        const auto s = std::sin(o.angle);
+        const auto [s, c] = sincos(o.angle);
         return {{c, s}, {-s, c}};
     }
 
@@ -106,8 +110,7 @@ namespace Xyz
         to_matrix(const Orientation<T, 2>& o,
                   const Vector<std::type_identity_t<T>, 2>& offset = {})
         {
-            const auto c = std::cos(o.angle);
-            const auto s = std::sin(o.angle);
+            const auto [s, c] = sincos(o.angle);
             return {
                 c, -s, offset[0],
                 s, c, offset[1],
@@ -159,10 +162,8 @@ namespace Xyz
     [[nodiscard]]
     Vector<T, 3> get_x_vector(const Orientation<T, 3>& o)
     {
-        auto c_y = std::cos(o.yaw);
-        auto s_y = std::sin(o.yaw);
-        auto c_p = std::cos(o.pitch);
-        auto s_p = std::sin(o.pitch);
+        const auto [s_y, c_y] = sincos(o.yaw);
+        const auto [s_p, c_p] = sincos(o.pitch);
 
         return {
             c_y * c_p,
@@ -175,12 +176,9 @@ namespace Xyz
     [[nodiscard]]
     Vector<T, 3> get_y_vector(const Orientation<T, 3>& o)
     {
-        auto c_y = std::cos(o.yaw);
-        auto s_y = std::sin(o.yaw);
-        auto c_p = std::cos(o.pitch);
-        auto s_p = std::sin(o.pitch);
-        auto c_r = std::cos(o.roll);
-        auto s_r = std::sin(o.roll);
+        const auto [s_y, c_y] = sincos(o.yaw);
+        const auto [s_p, c_p] = sincos(o.pitch);
+        const auto [s_r, c_r] = sincos(o.roll);
 
         return {
             c_y * s_p * s_r - s_y * c_r,
@@ -193,12 +191,9 @@ namespace Xyz
     [[nodiscard]]
     Vector<T, 3> get_z_vector(const Orientation<T, 3>& o)
     {
-        auto c_y = std::cos(o.yaw);
-        auto s_y = std::sin(o.yaw);
-        auto c_p = std::cos(o.pitch);
-        auto s_p = std::sin(o.pitch);
-        auto c_r = std::cos(o.roll);
-        auto s_r = std::sin(o.roll);
+        const auto [s_y, c_y] = sincos(o.yaw);
+        const auto [s_p, c_p] = sincos(o.pitch);
+        const auto [s_r, c_r] = sincos(o.roll);
 
         return {
             c_y * s_p * c_r + s_y * s_r,
@@ -212,12 +207,9 @@ namespace Xyz
     std::tuple<Vector<T, 3>, Vector<T, 3>, Vector<T, 3>>
     get_vectors(const Orientation<T, 3>& o)
     {
-        auto c_y = std::cos(o.yaw);
-        auto s_y = std::sin(o.yaw);
-        auto c_p = std::cos(o.pitch);
-        auto s_p = std::sin(o.pitch);
-        auto c_r = std::cos(o.roll);
-        auto s_r = std::sin(o.roll);
+        const auto [s_y, c_y] = sincos(o.yaw);
+        const auto [s_p, c_p] = sincos(o.pitch);
+        const auto [s_r, c_r] = sincos(o.roll);
 
         return {
             Vector<T, 3>{c_y * c_p, s_y * c_p, -s_p},
@@ -302,6 +294,100 @@ namespace Xyz
         );
     }
 
+    namespace Details
+    {
+        template <TrigPrecision P, std::floating_point T>
+        Quaternion<T> to_quaternion(const Orientation<T, 3>& o)
+        {
+            const auto [s_y, c_y] = get_sincos<P>(o.yaw / 2);
+            const auto [s_p, c_p] = get_sincos<P>(o.pitch / 2);
+            const auto [s_r, c_r] = get_sincos<P>(o.roll / 2);
+
+            // The rotations are applied in the order roll, pitch, yaw, so
+            // the quaternion is the product yaw * pitch * roll.
+            return {
+                c_r * c_p * c_y + s_r * s_p * s_y,
+                s_r * c_p * c_y - c_r * s_p * s_y,
+                c_r * s_p * c_y + s_r * c_p * s_y,
+                c_r * c_p * s_y - s_r * s_p * c_y
+            };
+        }
+
+        template <TrigPrecision P, std::floating_point T>
+        Orientation<T, 3> to_orientation(const Quaternion<T>& q)
+        {
+            const auto u = normalize(q);
+            const auto [x, y, z] = u.v;
+            const auto w = u.w;
+
+            const auto sin_pitch = T(2) * (w * y - z * x);
+            if (std::abs(sin_pitch) >= 1 - Margin<T>::DEFAULT)
+            {
+                // Gimbal lock: the roll and yaw axes coincide, so pick
+                // roll = 0.
+                constexpr auto pi = Constants<T>::PI;
+                return {
+                    T(2) * get_atan2<P>(z, w),
+                    sin_pitch > 0 ? pi / 2 : -pi / 2,
+                    0
+                };
+            }
+
+            return {
+                get_atan2<P>(T(2) * (w * z + x * y),
+                             T(1) - T(2) * (y * y + z * z)),
+                get_asin<P>(sin_pitch),
+                get_atan2<P>(T(2) * (w * x + y * z),
+                             T(1) - T(2) * (x * x + y * y))
+            };
+        }
+
+        template <TrigPrecision P, std::floating_point T>
+        Matrix<T, 3, 3> to_matrix(const Orientation<T, 3>& o)
+        {
+            const auto [s_a, c_a] = get_sincos<P>(o.yaw);
+            const auto [s_b, c_b] = get_sincos<P>(o.pitch);
+            const auto [s_c, c_c] = get_sincos<P>(o.roll);
+            return {
+                c_a * c_b, c_a * s_b * s_c - s_a * c_c, c_a * s_b * c_c + s_a * s_c,
+                s_a * c_b, s_a * s_b * s_c + c_a * c_c, s_a * s_b * c_c - c_a * s_c,
+                -s_b, c_b * s_c, c_b * c_c
+            };
+        }
+
+        template <TrigPrecision P>
+        using TrigPrecisionTag = std::integral_constant<TrigPrecision, P>;
+
+        /**
+         * @brief Applies @a func to every value in @a values and writes the
+         *  results to @a result, with the trigonometric functions selected
+         *  by @a precision.
+         *
+         * @a func is called with a TrigPrecisionTag, so that the precision
+         * is resolved once per batch rather than once per value.
+         */
+        template <typename In, typename Out, typename Func>
+        void convert_orientations(std::span<const In> values,
+                                  std::span<Out> result,
+                                  TrigPrecision precision,
+                                  Func func)
+        {
+            if (result.size() < values.size())
+                XYZ_THROW("The result span is smaller than the input span.");
+
+            if (precision == TrigPrecision::FAST)
+            {
+                for (size_t i = 0; i < values.size(); ++i)
+                    result[i] = func(TrigPrecisionTag<TrigPrecision::FAST>(), values[i]);
+            }
+            else
+            {
+                for (size_t i = 0; i < values.size(); ++i)
+                    result[i] = func(TrigPrecisionTag<TrigPrecision::STANDARD>(), values[i]);
+            }
+        }
+    }
+
     /**
      * @brief Returns the unit quaternion that corresponds to @a o.
      */
@@ -309,21 +395,31 @@ namespace Xyz
     [[nodiscard]]
     Quaternion<T> to_quaternion(const Orientation<T, 3>& o)
     {
-        const auto c_y = std::cos(o.yaw / 2);
-        const auto s_y = std::sin(o.yaw / 2);
-        const auto c_p = std::cos(o.pitch / 2);
-        const auto s_p = std::sin(o.pitch / 2);
-        const auto c_r = std::cos(o.roll / 2);
-        const auto s_r = std::sin(o.roll / 2);
-
-        // The rotations are applied in the order roll, pitch, yaw, so the
-        // quaternion is the product yaw * pitch * roll.
-        return {
-            c_r * c_p * c_y + s_r * s_p * s_y,
-            s_r * c_p * c_y - c_r * s_p * s_y,
-            c_r * s_p * c_y + s_r * c_p * s_y,
-            c_r * c_p * s_y - s_r * s_p * c_y
-        };
+        return Details::to_quaternion<TrigPrecision::STANDARD>(o);
+    }
+
+    /**
+     * @brief Converts every orientation in @a orientations to a unit
+     *  quaternion and writes it to @a result.
+     *
+     * With TrigPrecision::FAST, the sines and cosines are computed with
+     * fast_sincos, and the components of the quaternions are within about
+     * 1e-11 (double) or 1e-7 (float) of the standard results.
+     *
+     * @throws XyzException if @a result is smaller than @a orientations.
+     */
+    template <std::floating_point T>
+    void to_quaternion(std::type_identity_t<std::span<const Orientation<T, 3>>> orientations,
+                       std::span<Quaternion<T>> result,
+                       TrigPrecision precision = TrigPrecision::STANDARD)
+    {
+        Details::convert_orientations(
+            orientations, result, precision,
+            []<TrigPrecision P>(Details::TrigPrecisionTag<P>,
+                                const Orientation<T, 3>& o)
+            {
+                return Details::to_quaternion<P>(o);
+            });
     }
 
     /**
@@ -338,27 +434,32 @@ namespace Xyz
     [[nodiscard]]
     Orientation<T, 3> to_orientation(const Quaternion<T>& q)
     {
-        const auto u = normalize(q);
-        const auto [x, y, z] = u.v;
-        const auto w = u.w;
-
-        const auto sin_pitch = T(2) * (w * y - z * x);
-        if (std::abs(sin_pitch) >= 1 - Margin<T>::DEFAULT)
-        {
-            // Gimbal lock: the roll and yaw axes coincide, so pick roll = 0.
-            constexpr auto pi = Constants<T>::PI;
-            return {
-                T(2) * std::atan2(z, w),
-                sin_pitch > 0 ? pi / 2 : -pi / 2,
-                0
-            };
-        }
+        return Details::to_orientation<TrigPrecision::STANDARD>(q);
+    }
 
-        return {
-            std::atan2(T(2) * (w * z + x * y), T(1) - T(2) * (y * y + z * z)),
-            std::asin(sin_pitch),
-            std::atan2(T(2) * (w * x + y * z), T(1) - T(2) * (x * x + y * y))
-        };
+    /**
+     * @brief Converts every quaternion in @a quaternions to an orientation
+     *  and writes it to @a result.
+     *
+     * With TrigPrecision::FAST, the angles are computed with fast_atan2 and
+     * fast_asin, and are within about 1e-10 (double) or 5e-7 (float) of
+     * the standard results, except near gimbal lock, where asin itself is
+     * ill-conditioned.
+     *
+     * @throws XyzException if @a result is smaller than @a quaternions.
+     */
+    template <std::floating_point T>
+    void to_orientation(std::type_identity_t<std::span<const Quaternion<T>>> quaternions,
+                        std::span<Orientation<T, 3>> result,
+                        TrigPrecision precision = TrigPrecision::STANDARD)
+    {
+        Details::convert_orientations(
+            quaternions, result, precision,
+            []<TrigPrecision P>(Details::TrigPrecisionTag<P>,
+                                const Quaternion<T>& q)
+            {
+                return Details::to_orientation<P>(q);
+            });
     }
 
     namespace linear
@@ -367,17 +468,28 @@ namespace Xyz
         [[nodiscard]]
         Matrix<T, 3, 3> to_matrix(const Orientation<T, 3>& o)
         {
-            auto c_a = std::cos(o.yaw);
-            auto s_a = std::sin(o.yaw);
-            auto c_b = std::cos(o.pitch);
-            auto s_b = std::sin(o.pitch);
-            auto c_c = std::cos(o.roll);
-            auto s_c = std::sin(o.roll);
-            return {
-                c_a * c_b, c_a * s_b * s_c - s_a * c_c, c_a * s_b * c_c + s_a * s_c,
-                s_a * c_b, s_a * s_b * s_c + c_a * c_c, s_a * s_b * c_c - c_a * s_c,
-                -s_b, c_b * s_c, c_b * c_c
-            };
+            return Details::to_matrix<TrigPrecision::STANDARD>(o);
+        }
+
+        /**
+         * @brief Converts every orientation in @a orientations to a
+         *  rotation matrix and writes it to @a result.
+         *
+         * @throws XyzException if @a result is smaller than
+         *  @a orientations.
+         */
+        template <std::floating_point T>
+        void to_matrix(std::type_identity_t<std::span<const Orientation<T, 3>>> orientations,
+                       std::span<Matrix<T, 3, 3>> result,
+                       TrigPrecision precision = TrigPrecision::STANDARD)
+        {
+            Details::convert_orientations(
+                orientations, result, precision,
+                []<TrigPrecision P>(Details::TrigPrecisionTag<P>,
+                                    const Orientation<T, 3>& o)
+                {
+                    return Details::to_matrix<P>(o);
+                });
         }
     }
 
@@ -389,16 +501,11 @@ namespace Xyz
         to_matrix(const Orientation<T, 3>& o,
                   const Vector<std::type_identity_t<T>, 3>& offset = {})
         {
-            auto c_a = std::cos(o.yaw);
-            auto s_a = std::sin(o.yaw);
-            auto c_b = std::cos(o.pitch);
-            auto s_b = std::sin(o.pitch);
-            auto c_c = std::cos(o.roll);
-            auto s_c = std::sin(o.roll);
+            const auto r = Details::to_matrix<TrigPrecision::STANDARD>(o);
             return {
-                c_a * c_b, c_a * s_b * s_c - s_a * c_c, c_a * s_b * c_c + s_a * s_c, offset.x,
-                s_a * c_b, s_a * s_b * s_c + c_a * c_c, s_a * s_b * c_c - c_a * s_c, offset.y,
-                -s_b, c_b * s_c, c_b * c_c, offset.z,
+                r[0, 0], r[0, 1], r[0, 2], offset[0],
+                r[1, 0], r[1, 1], r[1, 2], offset[1],
+                r[2, 0], r[2, 1], r[2, 2], offset[2],
                 0, 0, 0, 1
             };
         }
@@ -29,4 +29,12 @@ namespace Xyz
         const auto [l, w, h] = cuboid.size;
         return {x * l, y * w, z * h};
     }
+
+    template <std::floating_point T>
+    [[nodiscard]]
+    Vector<T, 3> get_center(const OrientedCuboid<T>& cuboid)
+    {
+        const auto [x, y, z] = get_vectors(cuboid);
+        return cuboid.placement.origin + (x + y + z) / T(2);
+    }
 }
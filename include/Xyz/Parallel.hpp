@@ -0,0 +1,99 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace Xyz
+{
+    /**
+     * @brief Returns @a thread_count, or the number of hardware threads if
+     *  @a thread_count is 0.
+     */
+    inline unsigned get_thread_count(unsigned thread_count)
+    {
+        if (thread_count != 0)
+            return thread_count;
+        return std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    namespace Details
+    {
+        /**
+         * @brief Returns the number of chunks parallel_for will split
+         *  @a count items into.
+         */
+        inline size_t get_chunk_count(size_t count,
+                                      unsigned thread_count,
+                                      size_t min_chunk_size)
+        {
+            const auto max_chunks = std::max<size_t>(
+                1, count / std::max<size_t>(1, min_chunk_size));
+            return std::min<size_t>(get_thread_count(thread_count),
+                                    max_chunks);
+        }
+
+        /**
+         * @brief Splits the range [0, @a count) into contiguous chunks and
+         *  calls @a func(chunk_index, begin, end) for each of them, one
+         *  chunk per thread.
+         *
+         * The number of chunks is given by get_chunk_count. The last chunk
+         * is processed by the calling thread, so no threads are started if
+         * there is only one chunk. If @a func throws, the first exception is
+         * rethrown after all threads have finished.
+         */
+        template <typename Func>
+        void parallel_for(size_t count,
+                          unsigned thread_count,
+                          size_t min_chunk_size,
+                          Func&& func)
+        {
+            const auto chunks = get_chunk_count(count, thread_count,
+                                                min_chunk_size);
+            if (chunks <= 1)
+            {
+                func(size_t(0), size_t(0), count);
+                return;
+            }
+
+            std::vector<std::exception_ptr> errors(chunks);
+            std::vector<std::thread> threads;
+            threads.reserve(chunks - 1);
+
+            auto run_chunk = [&](size_t chunk)
+            {
+                try
+                {
+                    func(chunk, count * chunk / chunks,
+                         count * (chunk + 1) / chunks);
+                }
+                catch (...)
+                {
+                    errors[chunk] = std::current_exception();
+                }
+            };
+
+            for (size_t i = 0; i < chunks - 1; ++i)
+                threads.emplace_back(run_chunk, i);
+            run_chunk(chunks - 1);
+
+            for (auto& thread : threads)
+                thread.join();
+
+            for (auto& error : errors)
+            {
+                if (error)
+                    std::rethrow_exception(error);
+            }
+        }
+    }
+}
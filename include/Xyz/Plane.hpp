@@ -34,6 +34,21 @@ namespace Xyz
         }
     };
 
+    /**
+     * @brief Returns the signed distance from @a plane to @a point.
+     *
+     * The distance is positive on the side the normal points to. It is
+     * only a true distance if the normal has unit length, otherwise it is
+     * scaled by the length of the normal.
+     */
+    template <typename T>
+    [[nodiscard]]
+    constexpr T get_signed_distance(const Plane<T>& plane,
+                                    const Vector<T, 3>& point)
+    {
+        return dot(plane.normal, point - plane.origin);
+    }
+
     template <typename T, std::floating_point FloatT = FloatType_t<T>>
     [[nodiscard]]
     Matrix<FloatT, 4, 4> make_projection_matrix(const Plane<T>& plane)
@@ -0,0 +1,182 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <span>
+#include <type_traits>
+
+#include "BBox.hpp"
+#include "Parallel.hpp"
+
+namespace Xyz
+{
+    /**
+     * @brief The bounding box, centroid and covariance of a set of points.
+     */
+    template <std::floating_point T, unsigned N>
+    struct PointStatistics
+    {
+        size_t count = 0;
+        BBox<T, N> bbox;
+        Vector<T, N> centroid;
+        /**
+         * @brief The population covariance, i.e. the sum of the outer
+         *  products of the points' offsets from the centroid divided by
+         *  the number of points.
+         */
+        Matrix<T, N, N> covariance;
+    };
+
+    namespace Details
+    {
+        /**
+         * @brief Running sums for PointStatistics.
+         *
+         * The sums are of the offsets from a common reference point rather
+         * than of the points themselves. As long as the reference point is
+         * close to the points, this avoids the catastrophic cancellation in
+         * the one-pass formula cov = E[xx^T] - E[x]E[x]^T, and sums computed
+         * over different chunks of the same point set can simply be added.
+         */
+        template <std::floating_point T, unsigned N>
+        struct PointSums
+        {
+            using Acc = std::common_type_t<T, double>;
+
+            BBox<T, N> bbox;
+            Acc sum[N] = {};
+            Acc products[N * (N + 1) / 2] = {};
+
+            void add(const Vector<T, N>& point, const Vector<T, N>& reference)
+            {
+                Acc d[N];
+                for (unsigned i = 0; i < N; ++i)
+                {
+                    bbox.min[i] = std::min(bbox.min[i], point[i]);
+                    bbox.max[i] = std::max(bbox.max[i], point[i]);
+                    d[i] = Acc(point[i]) - Acc(reference[i]);
+                    sum[i] += d[i];
+                }
+
+                // Only the upper triangle of the symmetric matrix.
+                unsigned k = 0;
+                for (unsigned i = 0; i < N; ++i)
+                {
+                    for (unsigned j = i; j < N; ++j)
+                        products[k++] += d[i] * d[j];
+                }
+            }
+
+            PointSums& operator+=(const PointSums& other)
+            {
+                bbox += other.bbox;
+                for (unsigned i = 0; i < N; ++i)
+                    sum[i] += other.sum[i];
+                for (unsigned i = 0; i < N * (N + 1) / 2; ++i)
+                    products[i] += other.products[i];
+                return *this;
+            }
+        };
+    }
+
+    /**
+     * @brief Computes the bounding box, centroid and covariance of
+     *  @a points in a single pass over the data.
+     *
+     * The sums are accumulated in at least double precision.
+     *
+     * @param points The points.
+     * @param thread_count The number of threads to use. 0 means one per
+     *  hardware thread. Small inputs are always processed by the calling
+     *  thread alone.
+     */
+    template <std::floating_point T, unsigned N>
+    [[nodiscard]]
+    PointStatistics<T, N>
+    compute_point_statistics(std::span<const Vector<T, N>> points,
+                             unsigned thread_count = 1)
+    {
+        PointStatistics<T, N> result;
+        if (points.empty())
+            return result;
+
+        using Sums = Details::PointSums<T, N>;
+        using Acc = typename Sums::Acc;
+
+        const auto reference = points[0];
+        std::vector<Sums> sums(
+            Details::get_chunk_count(points.size(), thread_count, 1 << 16));
+        Details::parallel_for(
+            points.size(), thread_count, 1 << 16,
+            [&](size_t chunk, size_t begin, size_t end)
+            {
+                Sums chunk_sums;
+                for (size_t i = begin; i < end; ++i)
+                    chunk_sums.add(points[i], reference);
+                sums[chunk] = chunk_sums;
+            });
+
+        for (size_t i = 1; i < sums.size(); ++i)
+            sums[0] += sums[i];
+
+        const auto& total = sums[0];
+        const auto n = Acc(points.size());
+        Acc mean[N];
+        for (unsigned i = 0; i < N; ++i)
+        {
+            mean[i] = total.sum[i] / n;
+            result.centroid[i] = T(Acc(reference[i]) + mean[i]);
+        }
+
+        unsigned k = 0;
+        for (unsigned i = 0; i < N; ++i)
+        {
+            for (unsigned j = i; j < N; ++j)
+            {
+                const auto c = T(total.products[k++] / n - mean[i] * mean[j]);
+                result.covariance[i, j] = c;
+                result.covariance[j, i] = c;
+            }
+        }
+
+        result.count = points.size();
+        result.bbox = total.bbox;
+        return result;
+    }
+
+    /**
+     * @brief Returns the centroid, i.e. the average, of @a points.
+     *
+     * Returns the zero vector if @a points is empty.
+     */
+    template <std::floating_point T, unsigned N>
+    [[nodiscard]]
+    Vector<T, N> compute_centroid(std::span<const Vector<T, N>> points,
+                                  unsigned thread_count = 1)
+    {
+        using Acc = std::common_type_t<T, double>;
+        if (points.empty())
+            return {};
+
+        std::vector<Vector<Acc, N>> sums(
+            Details::get_chunk_count(points.size(), thread_count, 1 << 16));
+        Details::parallel_for(
+            points.size(), thread_count, 1 << 16,
+            [&](size_t chunk, size_t begin, size_t end)
+            {
+                Vector<Acc, N> sum;
+                for (size_t i = begin; i < end; ++i)
+                    sum += vector_cast<Acc>(points[i]);
+                sums[chunk] = sum;
+            });
+
+        Vector<Acc, N> total;
+        for (const auto& sum : sums)
+            total += sum;
+        return vector_cast<T>(total / Acc(points.size()));
+    }
+}
@@ -0,0 +1,86 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include "Vector.hpp"
+
+/**
+ * @file
+ * @brief Robust geometric predicates in the style of Jonathan Shewchuk's
+ *  "Adaptive Precision Floating-Point Arithmetic and Fast Robust Geometric
+ *  Predicates".
+ *
+ * Each predicate first evaluates its determinant with ordinary double
+ * arithmetic, and compares it with an upper bound on the rounding error.
+ * Only if the error could change the determinant's sign is the
+ * determinant evaluated again with exact expansion arithmetic, which is
+ * much slower, but only needed for nearly degenerate input.
+ *
+ * The sign of the returned value is always correct, which is all that
+ * matters; its magnitude is only an approximation of the determinant.
+ * The exact arithmetic assumes that no intermediate value overflows or
+ * underflows.
+ */
+
+namespace Xyz
+{
+    /**
+     * @brief Returns a positive value if @a a, @a b and @a c are in
+     *  counterclockwise order, a negative value if they are in clockwise
+     *  order, and zero if they are colinear.
+     *
+     * The value is twice the signed area of the triangle abc.
+     */
+    [[nodiscard]]
+    double orient2d(const Vector<double, 2>& a,
+                    const Vector<double, 2>& b,
+                    const Vector<double, 2>& c);
+
+    /**
+     * @brief Returns a positive value if @a d is below the plane through
+     *  @a a, @a b and @a c, a negative value if it is above the plane, and
+     *  zero if the four points are coplanar.
+     *
+     * "Below" is the side from which @a a, @a b and @a c appear in
+     * clockwise order. The value is six times the signed volume of the
+     * tetrahedron abcd.
+     */
+    [[nodiscard]]
+    double orient3d(const Vector<double, 3>& a,
+                    const Vector<double, 3>& b,
+                    const Vector<double, 3>& c,
+                    const Vector<double, 3>& d);
+
+    /**
+     * @brief Returns a positive value if @a d is inside the circle through
+     *  @a a, @a b and @a c, a negative value if it is outside, and zero if
+     *  the four points are cocircular.
+     *
+     * @a a, @a b and @a c must be in counterclockwise order, i.e.
+     * orient2d(a, b, c) must be positive, otherwise the sign is reversed.
+     */
+    [[nodiscard]]
+    double incircle(const Vector<double, 2>& a,
+                    const Vector<double, 2>& b,
+                    const Vector<double, 2>& c,
+                    const Vector<double, 2>& d);
+
+    /**
+     * @brief Returns a positive value if @a e is inside the sphere through
+     *  @a a, @a b, @a c and @a d, a negative value if it is outside, and
+     *  zero if the five points are cospherical.
+     *
+     * orient3d(a, b, c, d) must be positive, otherwise the sign is
+     * reversed.
+     */
+    [[nodiscard]]
+    double insphere(const Vector<double, 3>& a,
+                    const Vector<double, 3>& b,
+                    const Vector<double, 3>& c,
+                    const Vector<double, 3>& d,
+                    const Vector<double, 3>& e);
+}
@@ -7,6 +7,7 @@
 //****************************************************************************
 #pragma once
 #include <concepts>
+#include <span>
 #include "Constants.hpp"
 #include "Matrix.hpp"
 #include "Vector.hpp"
@@ -150,6 +151,19 @@ namespace Xyz
         return {q.w, -q.v};
     }
 
+    /**
+     * @brief Returns the four-dimensional dot product of @a p and @a q.
+     *
+     * For unit quaternions, this is the cosine of half the angle between
+     * the two rotations.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    constexpr T dot(const Quaternion<T>& p, const Quaternion<T>& q)
+    {
+        return p.w * q.w + dot(p.v, q.v);
+    }
+
     template <std::floating_point T>
     [[nodiscard]]
     constexpr T get_length_squared(const Quaternion<T>& q)
@@ -280,6 +294,25 @@ namespace Xyz
                 xz - wy, yz + wx, T(1) - xx - yy
             };
         }
+
+        /**
+         * @brief Converts every quaternion in @a quaternions to a rotation
+         *  matrix and writes it to @a result.
+         *
+         * @throws XyzException if @a result is smaller than
+         *  @a quaternions.
+         */
+        template <std::floating_point T>
+        void to_matrix(
+            std::type_identity_t<std::span<const Quaternion<T>>> quaternions,
+            std::span<Matrix<T, 3, 3>> result)
+        {
+            if (result.size() < quaternions.size())
+                XYZ_THROW("The result span is smaller than the quaternions span.");
+
+            for (size_t i = 0; i < quaternions.size(); ++i)
+                result[i] = to_matrix(quaternions[i]);
+        }
     }
 
     namespace affine
@@ -301,6 +334,79 @@ namespace Xyz
                 0, 0, 0, 1
             };
         }
+
+        /**
+         * @brief Converts every quaternion in @a quaternions to a
+         *  transformation matrix that rotates by the quaternion and then
+         *  translates by the offset with the same index in @a offsets.
+         *
+         * @throws XyzException if @a offsets or @a result is smaller than
+         *  @a quaternions.
+         */
+        template <std::floating_point T>
+        void to_matrix(
+            std::type_identity_t<std::span<const Quaternion<T>>> quaternions,
+            std::type_identity_t<std::span<const Vector<T, 3>>> offsets,
+            std::span<Matrix<T, 4, 4>> result)
+        {
+            if (offsets.size() < quaternions.size())
+                XYZ_THROW("The offsets span is smaller than the quaternions span.");
+            if (result.size() < quaternions.size())
+                XYZ_THROW("The result span is smaller than the quaternions span.");
+
+            for (size_t i = 0; i < quaternions.size(); ++i)
+                result[i] = to_matrix(quaternions[i], offsets[i]);
+        }
+
+        /**
+         * @brief Converts every quaternion in @a quaternions to a
+         *  transformation matrix without translation.
+         *
+         * @throws XyzException if @a result is smaller than
+         *  @a quaternions.
+         */
+        template <std::floating_point T>
+        void to_matrix(
+            std::type_identity_t<std::span<const Quaternion<T>>> quaternions,
+            std::span<Matrix<T, 4, 4>> result)
+        {
+            if (result.size() < quaternions.size())
+                XYZ_THROW("The result span is smaller than the quaternions span.");
+
+            for (size_t i = 0; i < quaternions.size(); ++i)
+                result[i] = to_matrix(quaternions[i]);
+        }
+    }
+
+    /**
+     * @brief Rotates every vector in @a vectors by @a q and writes the
+     *  results to @a result.
+     *
+     * The quaternion is converted to a rotation matrix once, which also
+     * takes care of its length, and each vector then costs a single
+     * matrix-vector product. That is about half the work of calling
+     * rotate for each vector.
+     *
+     * @a result can be the same span as @a vectors.
+     * @throws XyzException if @a result is smaller than @a vectors.
+     */
+    template <std::floating_point T>
+    void rotate(const Quaternion<T>& q,
+                std::type_identity_t<std::span<const Vector<T, 3>>> vectors,
+                std::type_identity_t<std::span<Vector<T, 3>>> result)
+    {
+        if (result.size() < vectors.size())
+            XYZ_THROW("The result span is smaller than the vectors span.");
+
+        const auto m = linear::to_matrix(q);
+        for (size_t i = 0; i < vectors.size(); ++i)
+        {
+            // Copy the vector first, as result may alias vectors.
+            const auto v = vectors[i];
+            result[i] = {m[0, 0] * v[0] + m[0, 1] * v[1] + m[0, 2] * v[2],
+                         m[1, 0] * v[0] + m[1, 1] * v[1] + m[1, 2] * v[2],
+                         m[2, 0] * v[0] + m[2, 1] * v[1] + m[2, 2] * v[2]};
+        }
     }
 
     /**
@@ -0,0 +1,277 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include "Quaternion.hpp"
+
+namespace Xyz
+{
+    /**
+     * @brief Returns the logarithm of the unit quaternion @a q, i.e. the
+     *  quaternion with w = 0 and v = axis * angle / 2.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    Quaternion<T> log(const Quaternion<T>& q)
+    {
+        const auto length = get_length(q.v);
+        if (length == 0)
+            return {0, 0, 0, 0};
+        return {0, q.v * (std::atan2(length, q.w) / length)};
+    }
+
+    /**
+     * @brief Returns the exponential of the quaternion @a q, whose w must
+     *  be 0. This is the inverse of log.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    Quaternion<T> exp(const Quaternion<T>& q)
+    {
+        const auto angle = get_length(q.v);
+        if (angle == 0)
+            return {};
+        return {std::cos(angle), q.v * (std::sin(angle) / angle)};
+    }
+
+    /**
+     * @brief Returns the normalized linear interpolation between the unit
+     *  quaternions @a p and @a q.
+     *
+     * If @a p and @a q are more than 180 degrees apart, -q is used instead
+     * of @a q, so the interpolation follows the shortest path.
+     *
+     * The result is on the same path as slerp, but the angular velocity
+     * isn't constant: it is highest at t = 0.5.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    Quaternion<T> nlerp(const Quaternion<T>& p,
+                        const Quaternion<T>& q,
+                        std::type_identity_t<T> t)
+    {
+        const auto s = dot(p, q) < 0 ? -t : t;
+        return normalize(p * (1 - t) + q * s);
+    }
+
+    namespace Details
+    {
+        /**
+         * @brief Above this value for the dot product, slerp falls back
+         *  to nlerp, as sin(angle) becomes too small to divide by.
+         *
+         * The angle between the two rotations is then less than 3.6
+         * degrees, where nlerp is practically identical to slerp.
+         */
+        template <std::floating_point T>
+        constexpr T SLERP_NLERP_THRESHOLD = T(0.9995);
+
+        /**
+         * @brief Slerp that doesn't check for the shortest path.
+         */
+        template <std::floating_point T>
+        Quaternion<T> slerp_no_flip(const Quaternion<T>& p,
+                                    const Quaternion<T>& q,
+                                    T t)
+        {
+            const auto d = dot(p, q);
+            if (std::abs(d) > SLERP_NLERP_THRESHOLD<T>)
+                return normalize(p * (1 - t) + q * t);
+
+            const auto angle = std::acos(std::clamp(d, T(-1), T(1)));
+            const auto sin_angle = std::sin(angle);
+            return p * (std::sin((1 - t) * angle) / sin_angle)
+                   + q * (std::sin(t * angle) / sin_angle);
+        }
+
+        template <typename... Sizes>
+        void check_interpolation_sizes(size_t result_size, Sizes... sizes)
+        {
+            if (((sizes != result_size) || ...))
+                XYZ_THROW("The input and result spans have different sizes.");
+        }
+    }
+
+    /**
+     * @brief Returns the spherical linear interpolation between the unit
+     *  quaternions @a p and @a q, i.e. the rotation that is a fraction @a t
+     *  of the way from @a p to @a q at constant angular velocity.
+     *
+     * If @a p and @a q are more than 180 degrees apart, -q is used instead
+     * of @a q, so the interpolation follows the shortest path. When the
+     * two are nearly equal, the result is computed with nlerp.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    Quaternion<T> slerp(const Quaternion<T>& p,
+                        const Quaternion<T>& q,
+                        std::type_identity_t<T> t)
+    {
+        return Details::slerp_no_flip(p, dot(p, q) < 0 ? -q : q, t);
+    }
+
+    /**
+     * @brief Returns an approximation of slerp(p, q, t) that costs about
+     *  as much as nlerp.
+     *
+     * The interpolation parameter is corrected with a cubic polynomial
+     * whose coefficients depend on the angle between @a p and @a q, which
+     * compensates for nlerp's uneven angular velocity. Compared to slerp,
+     * the error is less than 0.001 radians (0.06 degrees) for rotations
+     * up to 180 degrees apart, and less than 0.0001 radians for rotations
+     * up to 90 degrees apart.
+     *
+     * The coefficients are from Arseny Kapoulkine's "Approximating slerp".
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    Quaternion<T> fast_slerp(const Quaternion<T>& p,
+                             const Quaternion<T>& q,
+                             std::type_identity_t<T> t)
+    {
+        const auto d = std::abs(dot(p, q));
+        const auto a = T(1.0904) + d * (T(-3.2452) + d * (T(3.55645) - d * T(1.43519)));
+        const auto b = T(0.848013) + d * (T(-1.06021) + d * T(0.215638));
+        const auto k = a * (t - T(0.5)) * (t - T(0.5)) + b;
+        return nlerp(p, q, t + t * (t - T(0.5)) * (t - 1) * k);
+    }
+
+    /**
+     * @brief Returns the control point for keyframe @a q, with the
+     *  keyframes @a prev and @a next on either side, for use with squad.
+     *
+     * @a prev, @a q and @a next must be unit quaternions.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    Quaternion<T> squad_control_point(const Quaternion<T>& prev,
+                                      const Quaternion<T>& q,
+                                      const Quaternion<T>& next)
+    {
+        const auto inv_q = conjugate(q);
+        const auto p = dot(q, prev) < 0 ? -prev : prev;
+        const auto n = dot(q, next) < 0 ? -next : next;
+        return q * exp((log(inv_q * p) + log(inv_q * n)) * T(-0.25));
+    }
+
+    /**
+     * @brief Returns the spherical quadrangle interpolation between the
+     *  keyframes @a q0 and @a q1.
+     *
+     * Unlike a sequence of slerps, squad's angular velocity is continuous
+     * across keyframes, which gives smooth animations.
+     *
+     * @param q0, q1 Consecutive keyframes.
+     * @param a0, a1 Their control points, as returned by
+     *  squad_control_point.
+     * @param t The fraction of the way from @a q0 to @a q1.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    Quaternion<T> squad(const Quaternion<T>& q0,
+                        const Quaternion<T>& a0,
+                        const Quaternion<T>& a1,
+                        const Quaternion<T>& q1,
+                        std::type_identity_t<T> t)
+    {
+        // Follow the shortest path from q0 to q1. The control point must
+        // change sign along with its keyframe.
+        const auto flip = dot(q0, q1) < 0;
+        const auto r1 = flip ? -q1 : q1;
+        const auto b1 = flip ? -a1 : a1;
+        return Details::slerp_no_flip(Details::slerp_no_flip(q0, r1, t),
+                                      Details::slerp_no_flip(a0, b1, t),
+                                      2 * t * (1 - t));
+    }
+
+    /**
+     * @brief Writes nlerp(p[i], q[i], t[i]) to result[i] for every i.
+     *
+     * @throws XyzException if the spans have different sizes.
+     */
+    template <std::floating_point T>
+    void nlerp(std::type_identity_t<std::span<const Quaternion<T>>> p,
+               std::type_identity_t<std::span<const Quaternion<T>>> q,
+               std::type_identity_t<std::span<const T>> t,
+               std::span<Quaternion<T>> result)
+    {
+        Details::check_interpolation_sizes(result.size(), p.size(), q.size(),
+                                           t.size());
+        for (size_t i = 0; i < result.size(); ++i)
+            result[i] = nlerp(p[i], q[i], t[i]);
+    }
+
+    /**
+     * @brief Writes slerp(p[i], q[i], t[i]) to result[i] for every i.
+     *
+     * @throws XyzException if the spans have different sizes.
+     */
+    template <std::floating_point T>
+    void slerp(std::type_identity_t<std::span<const Quaternion<T>>> p,
+               std::type_identity_t<std::span<const Quaternion<T>>> q,
+               std::type_identity_t<std::span<const T>> t,
+               std::span<Quaternion<T>> result)
+    {
+        Details::check_interpolation_sizes(result.size(), p.size(), q.size(),
+                                           t.size());
+        for (size_t i = 0; i < result.size(); ++i)
+            result[i] = slerp(p[i], q[i], t[i]);
+    }
+
+    /**
+     * @brief Writes fast_slerp(p[i], q[i], t[i]) to result[i] for every i.
+     *
+     * @throws XyzException if the spans have different sizes.
+     */
+    template <std::floating_point T>
+    void fast_slerp(std::type_identity_t<std::span<const Quaternion<T>>> p,
+                    std::type_identity_t<std::span<const Quaternion<T>>> q,
+                    std::type_identity_t<std::span<const T>> t,
+                    std::span<Quaternion<T>> result)
+    {
+        Details::check_interpolation_sizes(result.size(), p.size(), q.size(),
+                                           t.size());
+        for (size_t i = 0; i < result.size(); ++i)
+            result[i] = fast_slerp(p[i], q[i], t[i]);
+    }
+
+    /**
+     * @brief Samples the rotation at @a time in a sequence of keyframes.
+     *
+     * Consecutive keyframes are interpolated with slerp. Times before the
+     * first keyframe or after the last one give the first or last
+     * keyframe.
+     *
+     * @param times The keyframes' times in ascending order.
+     * @param keyframes The keyframes' rotations, as unit quaternions.
+     * @throws XyzException if @a times and @a keyframes have different
+     *  sizes or are empty.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    Quaternion<T>
+    sample_keyframes(std::type_identity_t<std::span<const T>> times,
+                     std::type_identity_t<std::span<const Quaternion<T>>> keyframes,
+                     T time)
+    {
+        if (times.size() != keyframes.size() || times.empty())
+            XYZ_THROW("The times and keyframes must be non-empty and of equal size.");
+
+        const auto it = std::upper_bound(times.begin(), times.end(), time);
+        if (it == times.begin())
+            return keyframes.front();
+        if (it == times.end())
+            return keyframes.back();
+
+        const auto i = size_t(it - times.begin());
+        const auto t = (time - times[i - 1]) / (times[i] - times[i - 1]);
+        return slerp(keyframes[i - 1], keyframes[i], t);
+    }
+}
@@ -0,0 +1,424 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <algorithm>
+#include <optional>
+#include <queue>
+#include <set>
+#include <span>
+#include <vector>
+#include "LineLineIntersection.hpp"
+
+namespace Xyz
+{
+    /**
+     * @brief An intersection between two line segments in a set of
+     *  segments.
+     */
+    template <std::floating_point Float>
+    struct SegmentIntersection
+    {
+        /// The indexes of the two segments, first is less than second.
+        size_t first = 0;
+        size_t second = 0;
+        /// INTERSECTING if the segments cross each other, OVERLAPPING if
+        /// they are colinear and overlap.
+        IntersectionType type = IntersectionType::NON_INTERSECTING;
+        /// The part of each segment that is shared with the other, as
+        /// positions relative to the segment's start and end. The two
+        /// positions are equal unless the segments overlap.
+        std::pair<Float, Float> first_extent;
+        std::pair<Float, Float> second_extent;
+    };
+
+    namespace Details
+    {
+        /**
+         * @brief Returns the intersection between segment @a i and
+         *  segment @a j in @a segments, if there is one.
+         *
+         * The segments are classified exactly with get_intersection_type.
+         * Only then are the positions of crossing segments computed, and
+         * the shared parts of colinear ones found with
+         * get_intersection_extents. @a margin is only used for the
+         * latter, and colinear segments that only share an end point are
+         * not considered to overlap.
+         */
+        template <typename T, typename Float>
+        std::optional<SegmentIntersection<Float>>
+        get_segment_intersection(std::span<const LineSegment<T, 2>> segments,
+                                 size_t i, size_t j, Float margin)
+        {
+            if (j < i)
+                std::swap(i, j);
+
+            const auto type = get_intersection_type(segments[i], segments[j]);
+            if (type == IntersectionType::INTERSECTING)
+            {
+                // The segments are known to cross, the clamping only
+                // makes up for rounding errors in the positions.
+                auto [rel, t0, t1] = get_intersection_positions(
+                    make_line(segments[i]), make_line(segments[j]), Float());
+                t0 = clamp<Float>(t0, 0.0, 1.0);
+                t1 = clamp<Float>(t1, 0.0, 1.0);
+                return SegmentIntersection<Float>{
+                    i, j, type, {t0, t0}, {t1, t1}
+                };
+            }
+
+            if (type != IntersectionType::COLINEAR)
+                return {};
+
+            const auto [overlaps, extent_i, extent_j] = get_projection_extents(
+                segments[i], segments[j], margin);
+            if (!overlaps
+                || Approx<Float>(extent_i.first, margin) == extent_i.second)
+            {
+                return {};
+            }
+
+            return SegmentIntersection<Float>{
+                i, j, IntersectionType::OVERLAPPING, extent_i, extent_j
+            };
+        }
+
+        /**
+         * @brief The Bentley-Ottmann sweep line algorithm.
+         *
+         * The sweep line moves through the segment end points and
+         * intersection points in lexicographic order, i.e. by x and then
+         * by y, which is equivalent to a sweep line that is tilted ever so
+         * slightly counterclockwise from vertical. The status holds the
+         * segments that cross the sweep line, sorted from bottom to top.
+         * Segments are only tested against their neighbors in the status,
+         * and every pair of crossing segments are neighbors right before
+         * the sweep line reaches the crossing, where they swap places.
+         *
+         * The status is a set of slots rather than segments, so that two
+         * segments can swap places by swapping their slots' segments,
+         * without changing the set itself.
+         */
+        template <typename T, typename Float>
+        class SegmentSweep
+        {
+        public:
+            SegmentSweep(std::span<const LineSegment<T, 2>> segments,
+                         Float margin)
+                : segments_(segments),
+                  margin_(margin),
+                  status_(SlotLess{this})
+            {
+                const auto n = segments.size();
+                starts_.resize(n);
+                vectors_.resize(n);
+                slot_segments_.resize(n);
+                segment_slots_.resize(n, NO_SLOT);
+                slot_iterators_.resize(n);
+                for (size_t i = 0; i < n; ++i)
+                {
+                    // Every segment is swept from its lexicographically
+                    // smallest end point to the other.
+                    auto a = vector_cast<Float>(segments[i].start);
+                    auto b = vector_cast<Float>(segments[i].end);
+                    if (is_before(b, a))
+                        std::swap(a, b);
+                    starts_[i] = a;
+                    vectors_[i] = b - a;
+                    slot_segments_[i] = i;
+
+                    // Zero-length segments can't cross anything.
+                    if (a == b)
+                        continue;
+                    events_.push({a, EventType::START, i, i});
+                    events_.push({b, EventType::END, i, i});
+                }
+            }
+
+            std::vector<SegmentIntersection<Float>> run()
+            {
+                while (!events_.empty())
+                {
+                    const auto event = events_.top();
+                    events_.pop();
+                    sweep_point_ = event.point;
+                    switch (event.type)
+                    {
+                    case EventType::END:
+                        remove(event.first);
+                        break;
+                    case EventType::CROSSING:
+                        swap(event.first, event.second);
+                        break;
+                    case EventType::START:
+                        insert(event.first);
+                        break;
+                    }
+                }
+
+                std::ranges::sort(result_, [](const auto& a, const auto& b)
+                {
+                    return std::pair(a.first, a.second) < std::pair(b.first, b.second);
+                });
+                return std::move(result_);
+            }
+
+        private:
+            // At a given point, segments that end there are removed before
+            // crossing segments swap places, and new segments are inserted
+            // last.
+            enum class EventType
+            {
+                END,
+                CROSSING,
+                START
+            };
+
+            struct Event
+            {
+                Vector<Float, 2> point;
+                EventType type;
+                /// The segment, or the lower of two crossing segments.
+                size_t first;
+                /// The upper of two crossing segments.
+                size_t second;
+            };
+
+            struct EventGreater
+            {
+                bool operator()(const Event& a, const Event& b) const
+                {
+                    if (a.point != b.point)
+                        return is_before(b.point, a.point);
+                    return b.type < a.type;
+                }
+            };
+
+            struct SlotLess
+            {
+                const SegmentSweep* sweep;
+
+                bool operator()(size_t a, size_t b) const
+                {
+                    return sweep->is_below(sweep->slot_segments_[a],
+                                           sweep->slot_segments_[b]);
+                }
+            };
+
+            using Status = std::set<size_t, SlotLess>;
+            using StatusIterator = typename Status::iterator;
+
+            static constexpr size_t NO_SLOT = ~size_t(0);
+
+            static bool is_before(const Vector<Float, 2>& a,
+                                  const Vector<Float, 2>& b)
+            {
+                return a[0] < b[0] || (a[0] == b[0] && a[1] < b[1]);
+            }
+
+            /**
+             * @brief Returns the y coordinate of segment @a i where it
+             *  crosses the sweep line.
+             *
+             * Vertical segments are on the sweep line, and their y
+             * coordinate is that of the sweep point, clamped to the
+             * segment.
+             */
+            Float get_sweep_y(size_t i) const
+            {
+                const auto& p = starts_[i];
+                const auto& v = vectors_[i];
+                if (v[0] == 0)
+                    return std::clamp(sweep_point_[1], p[1], p[1] + v[1]);
+                if (sweep_point_[0] == p[0])
+                    return p[1];
+                if (sweep_point_[0] == p[0] + v[0])
+                    return p[1] + v[1];
+                return p[1] + (sweep_point_[0] - p[0]) * v[1] / v[0];
+            }
+
+            /**
+             * @brief Returns true if segment @a a is below segment @a b
+             *  immediately after the sweep line.
+             */
+            bool is_below(size_t a, size_t b) const
+            {
+                if (a == b)
+                    return false;
+
+                const auto ya = get_sweep_y(a);
+                const auto yb = get_sweep_y(b);
+                if (ya != yb)
+                    return ya < yb;
+
+                // Segments that meet at the sweep line are ordered by
+                // their directions, vertical segments last.
+                const auto c = cross(vectors_[a], vectors_[b]);
+                if (c != 0)
+                    return c > 0;
+                return a < b;
+            }
+
+            static Float cross(const Vector<Float, 2>& a,
+                               const Vector<Float, 2>& b)
+            {
+                return a[0] * b[1] - a[1] * b[0];
+            }
+
+            void insert(size_t i)
+            {
+                const auto [it, inserted] = status_.insert(i);
+                slot_iterators_[i] = it;
+                segment_slots_[i] = i;
+
+                // Colinear segments that overlap all have the same
+                // position in the status, and are only ordered by index.
+                // Find all of them, not just the nearest neighbors.
+                StatusIterator below = it, above = std::next(it);
+                while (below != status_.begin()
+                       && report_overlap(i, slot_segments_[*std::prev(below)]))
+                {
+                    --below;
+                }
+                while (above != status_.end()
+                       && report_overlap(i, slot_segments_[*above]))
+                {
+                    ++above;
+                }
+
+                if (it != status_.begin())
+                    check_crossing(slot_segments_[*std::prev(it)], i);
+                if (std::next(it) != status_.end())
+                    check_crossing(i, slot_segments_[*std::next(it)]);
+            }
+
+            void remove(size_t i)
+            {
+                const auto slot = segment_slots_[i];
+                if (slot == NO_SLOT)
+                    return;
+
+                const auto it = slot_iterators_[slot];
+                const auto next = std::next(it);
+                if (it != status_.begin() && next != status_.end())
+                {
+                    check_crossing(slot_segments_[*std::prev(it)],
+                                   slot_segments_[*next]);
+                }
+                status_.erase(it);
+                segment_slots_[i] = NO_SLOT;
+            }
+
+            void swap(size_t lower, size_t upper)
+            {
+                const auto lower_slot = segment_slots_[lower];
+                const auto upper_slot = segment_slots_[upper];
+                if (lower_slot == NO_SLOT || upper_slot == NO_SLOT)
+                    return;
+
+                // The event is out of date unless the two segments are
+                // still neighbors in the same order.
+                const auto lower_it = slot_iterators_[lower_slot];
+                const auto upper_it = std::next(lower_it);
+                if (upper_it == status_.end() || *upper_it != upper_slot)
+                    return;
+
+                std::swap(slot_segments_[lower_slot], slot_segments_[upper_slot]);
+                std::swap(segment_slots_[lower], segment_slots_[upper]);
+
+                if (auto r = get_segment_intersection(segments_, lower, upper, margin_))
+                    result_.push_back(*r);
+
+                if (lower_it != status_.begin())
+                    check_crossing(slot_segments_[*std::prev(lower_it)], upper);
+                if (const auto next = std::next(upper_it); next != status_.end())
+                    check_crossing(lower, slot_segments_[*next]);
+            }
+
+            /**
+             * @brief Reports segments @a i and @a j if they overlap, and
+             *  returns true if they do.
+             */
+            bool report_overlap(size_t i, size_t j)
+            {
+                const auto r = get_segment_intersection(segments_, i, j, margin_);
+                if (!r || r->type != IntersectionType::OVERLAPPING)
+                    return false;
+                result_.push_back(*r);
+                return true;
+            }
+
+            /**
+             * @brief Adds a crossing event if the neighbors @a lower and
+             *  @a upper cross each other somewhere ahead of the sweep line.
+             */
+            void check_crossing(size_t lower, size_t upper)
+            {
+                const auto& va = vectors_[lower];
+                const auto& vb = vectors_[upper];
+                const auto denominator = cross(va, vb);
+                // Unless the lower segment turns upwards relative to the
+                // upper one, they either have crossed already or never
+                // will.
+                if (denominator >= 0)
+                    return;
+
+                const auto ab = starts_[upper] - starts_[lower];
+                const auto ta = cross(ab, vb) / denominator;
+                const auto tb = cross(ab, va) / denominator;
+                if (ta < 0 || ta > 1 || tb < 0 || tb > 1)
+                    return;
+
+                auto point = starts_[lower] + ta * va;
+                if (is_before(point, sweep_point_))
+                    point = sweep_point_;
+                events_.push({point, EventType::CROSSING, lower, upper});
+            }
+
+            std::span<const LineSegment<T, 2>> segments_;
+            Float margin_;
+
+            std::vector<Vector<Float, 2>> starts_;
+            std::vector<Vector<Float, 2>> vectors_;
+
+            std::priority_queue<Event, std::vector<Event>, EventGreater> events_;
+            Vector<Float, 2> sweep_point_;
+
+            Status status_;
+            std::vector<size_t> slot_segments_;
+            std::vector<size_t> segment_slots_;
+            std::vector<StatusIterator> slot_iterators_;
+
+            std::vector<SegmentIntersection<Float>> result_;
+        };
+    }
+
+    /**
+     * @brief Returns all the pairs of segments in @a segments that
+     *  intersect, sorted by their indexes.
+     *
+     * Uses the Bentley-Ottmann sweep line algorithm, which runs in
+     * O((n + k) log n) time for n segments and k intersections, compared
+     * to O(n^2) for testing every pair.
+     *
+     * The pairs are classified with get_intersection_type, which is
+     * exact, and a pair is reported if it returns INTERSECTING, i.e.
+     * segments that only touch at an end point don't intersect. Pairs
+     * that it reports as COLINEAR are reported as OVERLAPPING if they
+     * share a part that is longer than @a margin relative to the first
+     * segment's length. Zero-length segments never intersect anything.
+     */
+    template <typename T, typename Float = FloatType_t<T>>
+    [[nodiscard]]
+    std::vector<SegmentIntersection<Float>>
+    find_segment_intersections(
+        std::type_identity_t<std::span<const LineSegment<T, 2>>> segments,
+        Float margin = Margin<Float>::DEFAULT)
+    {
+        return Details::SegmentSweep<T, Float>(segments, margin).run();
+    }
+}
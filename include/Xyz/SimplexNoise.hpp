@@ -15,10 +15,10 @@ namespace Xyz
     public:
         SimplexNoise();
 
-        double simplex(double x, double y, double z);
+        double simplex(double x, double y, double z) const;
 
         double simplex(double x, double y, double z,
-                       int octaves, double persistence);
+                       int octaves, double persistence) const;
     private:
         uint8_t permutation_[512];
     };
@@ -0,0 +1,444 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "BBox.hpp"
+#include "Frustum.hpp"
+#include "SymmetricEigenDecomposition.hpp"
+
+namespace Xyz
+{
+    /**
+     * @brief A sphere, or a circle if N is 2.
+     *
+     * A sphere with a negative radius is empty. Default-constructed spheres
+     * are empty, which makes them suitable as the starting point when
+     * merging spheres.
+     */
+    template <std::floating_point T, unsigned N>
+    struct Sphere
+    {
+        Vector<T, N> center;
+        T radius = -1;
+
+        constexpr explicit operator bool() const
+        {
+            return radius >= 0;
+        }
+    };
+
+    template <std::floating_point T, unsigned N>
+    [[nodiscard]]
+    constexpr bool operator==(const Sphere<T, N>& a, const Sphere<T, N>& b)
+    {
+        return a.center == b.center && a.radius == b.radius;
+    }
+
+    template <std::floating_point T, unsigned N>
+    [[nodiscard]]
+    constexpr bool operator!=(const Sphere<T, N>& a, const Sphere<T, N>& b)
+    {
+        return !(a == b);
+    }
+
+    template <std::floating_point T, unsigned N>
+    std::ostream& operator<<(std::ostream& os, const Sphere<T, N>& sphere)
+    {
+        return os << '{' << sphere.center << ", " << sphere.radius << '}';
+    }
+
+    /**
+     * @brief Returns true if @a point is inside or on the surface of
+     *  @a sphere.
+     */
+    template <std::floating_point T, unsigned N>
+    [[nodiscard]]
+    constexpr bool contains_point(const Sphere<T, N>& sphere,
+                                  const Vector<T, N>& point)
+    {
+        return sphere.radius >= 0
+               && get_length_squared(point - sphere.center)
+                  <= sphere.radius * sphere.radius;
+    }
+
+    /**
+     * @brief Returns the smallest sphere that contains both @a a and @a b.
+     */
+    template <std::floating_point T, unsigned N>
+    [[nodiscard]]
+    Sphere<T, N> merge(const Sphere<T, N>& a, const Sphere<T, N>& b)
+    {
+        if (!b)
+            return a;
+        if (!a)
+            return b;
+
+        const auto d = b.center - a.center;
+        const auto distance = get_length(d);
+        if (distance + b.radius <= a.radius)
+            return a;
+        if (distance + a.radius <= b.radius)
+            return b;
+
+        const auto radius = (distance + a.radius + b.radius) / 2;
+        return {a.center + d * ((radius - a.radius) / distance), radius};
+    }
+
+    /**
+     * @brief Returns a sphere that contains all of @a points.
+     *
+     * Uses Ritter's algorithm: the initial sphere spans two points that are
+     * far apart, and is then grown just enough to include each point that
+     * is outside it. It reads the points three times and is typically
+     * 5-20% larger than the minimal sphere.
+     *
+     * @return An empty sphere if @a points is empty.
+     */
+    template <std::floating_point T, unsigned N>
+    [[nodiscard]]
+    Sphere<T, N> compute_bounding_sphere(std::span<const Vector<T, N>> points)
+    {
+        if (points.empty())
+            return {};
+
+        auto get_farthest = [&](const Vector<T, N>& from)
+        {
+            size_t index = 0;
+            T max_distance = 0;
+            for (size_t i = 0; i < points.size(); ++i)
+            {
+                const auto distance = get_length_squared(points[i] - from);
+                if (distance > max_distance)
+                {
+                    max_distance = distance;
+                    index = i;
+                }
+            }
+            return points[index];
+        };
+
+        const auto a = get_farthest(points[0]);
+        const auto b = get_farthest(a);
+        Sphere<T, N> result{(a + b) / T(2), get_length(b - a) / 2};
+
+        for (const auto& point : points)
+        {
+            const auto d = point - result.center;
+            const auto distance_squared = get_length_squared(d);
+            if (distance_squared > result.radius * result.radius)
+            {
+                const auto distance = std::sqrt(distance_squared);
+                const auto radius = (result.radius + distance) / 2;
+                result.center += d * ((radius - result.radius) / distance);
+                result.radius = radius;
+            }
+        }
+        return result;
+    }
+
+    namespace Details
+    {
+        /**
+         * @brief Returns the smallest sphere that has all of @a points
+         *  on its surface.
+         *
+         * The center is p0 + sum(x_i * (p_i - p0)), where the x_i solve
+         * the linear system given by |c - p_i| = |c - p0| for all i. If
+         * the points are degenerate, e.g. three points on a line, the
+         * sphere spanned by the two points farthest apart is returned.
+         */
+        template <std::floating_point T, unsigned N>
+        Sphere<T, N> get_circumsphere(const Vector<T, N>* points,
+                                      unsigned count)
+        {
+            if (count == 0)
+                return {};
+            if (count == 1)
+                return {points[0], 0};
+
+            const auto n = count - 1;
+            Vector<T, N> v[N];
+            // The augmented matrix of the system.
+            T a[N][N + 1];
+            for (unsigned i = 0; i < n; ++i)
+                v[i] = points[i + 1] - points[0];
+            T max_diagonal = 0;
+            for (unsigned i = 0; i < n; ++i)
+            {
+                for (unsigned j = 0; j < n; ++j)
+                    a[i][j] = 2 * dot(v[i], v[j]);
+                a[i][n] = dot(v[i], v[i]);
+                max_diagonal = std::max(max_diagonal, a[i][i]);
+            }
+
+            // Gaussian elimination with partial pivoting.
+            const auto min_pivot = max_diagonal
+                                   * 1024 * std::numeric_limits<T>::epsilon();
+            bool degenerate = false;
+            for (unsigned col = 0; col < n; ++col)
+            {
+                unsigned pivot = col;
+                for (unsigned row = col + 1; row < n; ++row)
+                {
+                    if (std::abs(a[row][col]) > std::abs(a[pivot][col]))
+                        pivot = row;
+                }
+
+                if (std::abs(a[pivot][col]) <= min_pivot)
+                {
+                    degenerate = true;
+                    break;
+                }
+
+                for (unsigned j = 0; j <= n; ++j)
+                    std::swap(a[col][j], a[pivot][j]);
+                for (unsigned row = col + 1; row < n; ++row)
+                {
+                    const auto f = a[row][col] / a[col][col];
+                    for (unsigned j = col; j <= n; ++j)
+                        a[row][j] -= f * a[col][j];
+                }
+            }
+
+            if (!degenerate)
+            {
+                T x[N];
+                for (unsigned i = n; i-- > 0;)
+                {
+                    auto sum = a[i][n];
+                    for (unsigned j = i + 1; j < n; ++j)
+                        sum -= a[i][j] * x[j];
+                    x[i] = sum / a[i][i];
+                }
+
+                auto offset = Vector<T, N>();
+                for (unsigned i = 0; i < n; ++i)
+                    offset += v[i] * x[i];
+                return {points[0] + offset, get_length(offset)};
+            }
+
+            Sphere<T, N> result{points[0], 0};
+            for (unsigned i = 0; i < count; ++i)
+            {
+                for (unsigned j = i + 1; j < count; ++j)
+                {
+                    const auto radius = get_length(points[j] - points[i]) / 2;
+                    if (radius > result.radius)
+                        result = {(points[i] + points[j]) / T(2), radius};
+                }
+            }
+            return result;
+        }
+
+        template <std::floating_point T, unsigned N>
+        bool is_inside_welzl_sphere(const Sphere<T, N>& sphere,
+                                    const Vector<T, N>& point)
+        {
+            // Allow for rounding errors, otherwise points on the surface
+            // can trigger needless and numerically unstable recomputations.
+            const auto r = sphere.radius
+                           * (1 + 64 * std::numeric_limits<T>::epsilon());
+            return sphere.radius >= 0
+                   && get_length_squared(point - sphere.center) <= r * r;
+        }
+
+        /**
+         * @brief The core of Welzl's algorithm.
+         *
+         * Returns the smallest sphere that contains the first @a count
+         * points and has the first @a boundary_count points in @a boundary
+         * on its surface. The recursion depth is at most N + 1 as every
+         * level adds a point to the boundary.
+         */
+        template <std::floating_point T, unsigned N>
+        Sphere<T, N> get_welzl_sphere(std::span<const Vector<T, N>> points,
+                                      size_t count,
+                                      Vector<T, N>* boundary,
+                                      unsigned boundary_count)
+        {
+            auto result = get_circumsphere(boundary, boundary_count);
+            if (boundary_count == N + 1)
+                return result;
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (is_inside_welzl_sphere(result, points[i]))
+                    continue;
+                boundary[boundary_count] = points[i];
+                result = get_welzl_sphere(points, i, boundary,
+                                          boundary_count + 1);
+            }
+            return result;
+        }
+    }
+
+    /**
+     * @brief Returns the smallest sphere that contains all of @a points.
+     *
+     * Uses Welzl's algorithm on a randomly shuffled copy of the points,
+     * which has an expected running time that is linear in the number of
+     * points. It is considerably slower than compute_bounding_sphere, and
+     * is best suited for offline use, e.g. when meshes are loaded.
+     *
+     * @param points The points.
+     * @param random_engine The engine used to shuffle the points.
+     * @return An empty sphere if @a points is empty.
+     */
+    template <std::floating_point T, unsigned N>
+    [[nodiscard]]
+    Sphere<T, N>
+    compute_minimal_bounding_sphere(
+        std::span<const Vector<T, N>> points,
+        std::default_random_engine& random_engine)
+    {
+        std::vector<Vector<T, N>> shuffled(points.begin(), points.end());
+        std::shuffle(shuffled.begin(), shuffled.end(), random_engine);
+        Vector<T, N> boundary[N + 1];
+        return Details::get_welzl_sphere(
+            std::span<const Vector<T, N>>(shuffled), shuffled.size(),
+            boundary, 0);
+    }
+
+    /**
+     * @brief Returns the smallest sphere that contains all of @a points.
+     *
+     * Shuffles the points with a local engine with a fixed seed, which
+     * makes the function safe to call from several threads at once, and
+     * the running time for a given set of points reproducible.
+     */
+    template <std::floating_point T, unsigned N>
+    [[nodiscard]]
+    Sphere<T, N>
+    compute_minimal_bounding_sphere(std::span<const Vector<T, N>> points)
+    {
+        std::default_random_engine random_engine;
+        return compute_minimal_bounding_sphere(points, random_engine);
+    }
+
+    /**
+     * @brief Returns a sphere that contains @a sphere after it has been
+     *  transformed by the affine matrix @a m.
+     *
+     * The radius is multiplied by the largest factor @a m can scale a
+     * vector by, i.e. the square root of the largest eigenvalue of
+     * L^T * L, where L is the linear part of @a m. This is exact also when
+     * @a m has non-uniform scaling or shear, in which case the result is
+     * larger than the transformed shape, which is an ellipsoid.
+     */
+    template <std::floating_point T, unsigned N>
+    [[nodiscard]]
+    Sphere<T, N> transform_sphere(const Sphere<T, N>& sphere,
+                                  const Matrix<T, N + 1, N + 1>& m)
+    {
+        if (!sphere)
+            return sphere;
+
+        Matrix<T, N, N> linear;
+        Vector<T, N> center;
+        for (unsigned i = 0; i < N; ++i)
+        {
+            center[i] = m[i, N];
+            for (unsigned j = 0; j < N; ++j)
+            {
+                linear[i, j] = m[i, j];
+                center[i] += m[i, j] * sphere.center[j];
+            }
+        }
+
+        const auto e = get_symmetric_eigen_decomposition(
+            transpose(linear) * linear);
+        const auto scale = std::sqrt(std::max(e.values[0], T(0)));
+        return {center, sphere.radius * scale};
+    }
+
+    /**
+     * @brief Returns true if @a a and @a b overlap or touch.
+     */
+    template <std::floating_point T, unsigned N>
+    [[nodiscard]]
+    bool intersects(const Sphere<T, N>& a, const Sphere<T, N>& b)
+    {
+        if (!a || !b)
+            return false;
+        const auto r = a.radius + b.radius;
+        return get_length_squared(b.center - a.center) <= r * r;
+    }
+
+    /**
+     * @brief Returns true if @a sphere and @a box overlap or touch.
+     */
+    template <std::floating_point T, unsigned N>
+    [[nodiscard]]
+    bool intersects(const Sphere<T, N>& sphere, const BBox<T, N>& box)
+    {
+        if (!sphere || !box)
+            return false;
+
+        T distance_squared = 0;
+        for (unsigned i = 0; i < N; ++i)
+        {
+            const auto c = sphere.center[i];
+            if (c < box.min[i])
+                distance_squared += (box.min[i] - c) * (box.min[i] - c);
+            else if (c > box.max[i])
+                distance_squared += (c - box.max[i]) * (c - box.max[i]);
+        }
+        return distance_squared <= sphere.radius * sphere.radius;
+    }
+
+    template <std::floating_point T, unsigned N>
+    [[nodiscard]]
+    bool intersects(const BBox<T, N>& box, const Sphere<T, N>& sphere)
+    {
+        return intersects(sphere, box);
+    }
+
+    /**
+     * @brief Returns true if @a plane goes through @a sphere or touches it.
+     *
+     * The plane's normal doesn't have to be of unit length.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    bool intersects(const Sphere<T, 3>& sphere, const Plane<T>& plane)
+    {
+        if (!sphere)
+            return false;
+        const auto distance = get_signed_distance(plane, sphere.center);
+        return std::abs(distance) <= sphere.radius * get_length(plane.normal);
+    }
+
+    template <std::floating_point T>
+    [[nodiscard]]
+    bool intersects(const Plane<T>& plane, const Sphere<T, 3>& sphere)
+    {
+        return intersects(sphere, plane);
+    }
+
+    /**
+     * @brief Returns false if @a sphere is entirely outside @a frustum.
+     *
+     * The test is conservative, see intersects(frustum, center, radius).
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    bool intersects(const Frustum<T>& frustum, const Sphere<T, 3>& sphere)
+    {
+        return sphere && intersects(frustum, sphere.center, sphere.radius);
+    }
+
+    using CircleF = Sphere<float, 2>;
+    using CircleD = Sphere<double, 2>;
+    using SphereF = Sphere<float, 3>;
+    using SphereD = Sphere<double, 3>;
+}
@@ -0,0 +1,137 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cmath>
+#include <concepts>
+#include <limits>
+
+#include "Matrix.hpp"
+
+namespace Xyz
+{
+    /**
+     * @brief The eigenvalues and eigenvectors of a symmetric matrix.
+     *
+     * The eigenvalues are sorted in descending order, and column i of
+     * @a vectors is the unit eigenvector that belongs to eigenvalue i. The
+     * eigenvectors are orthonormal, i.e. @a vectors is a rotation or
+     * reflection matrix.
+     */
+    template <std::floating_point T, unsigned N>
+    struct SymmetricEigenDecomposition
+    {
+        Vector<T, N> values;
+        Matrix<T, N, N> vectors;
+    };
+
+    /**
+     * @brief Returns the eigenvalues and eigenvectors of the symmetric
+     *  matrix @a m.
+     *
+     * Uses the cyclic Jacobi method, which repeatedly applies plane
+     * rotations that zero one off-diagonal element at a time. For the small
+     * matrices in this library, typically covariance matrices, it converges
+     * in a handful of sweeps and is more accurate than solving the
+     * characteristic polynomial. Only the upper triangle of @a m is read.
+     */
+    template <std::floating_point T, unsigned N>
+    [[nodiscard]]
+    SymmetricEigenDecomposition<T, N>
+    get_symmetric_eigen_decomposition(const Matrix<T, N, N>& m)
+    {
+        auto a = m;
+        for (unsigned i = 0; i < N; ++i)
+        {
+            for (unsigned j = 0; j < i; ++j)
+                a[i, j] = a[j, i];
+        }
+        auto v = make_identity_matrix<T, N>();
+
+        constexpr unsigned MAX_SWEEPS = 50;
+        for (unsigned sweep = 0; sweep < MAX_SWEEPS; ++sweep)
+        {
+            T off_diagonal = 0;
+            T diagonal = 0;
+            for (unsigned p = 0; p < N; ++p)
+            {
+                diagonal += std::abs(a[p, p]);
+                for (unsigned q = p + 1; q < N; ++q)
+                    off_diagonal += std::abs(a[p, q]);
+            }
+
+            if (off_diagonal <= std::numeric_limits<T>::epsilon() * diagonal
+                || off_diagonal == 0)
+            {
+                break;
+            }
+
+            for (unsigned p = 0; p < N; ++p)
+            {
+                for (unsigned q = p + 1; q < N; ++q)
+                {
+                    if (a[p, q] == 0)
+                        continue;
+
+                    // Choose the smaller of the two rotation angles that
+                    // zero a[p, q]. t = tan(angle).
+                    const auto theta = (a[q, q] - a[p, p]) / (2 * a[p, q]);
+                    const auto t = (theta >= 0 ? T(1) : T(-1))
+                        / (std::abs(theta) + std::sqrt(theta * theta + 1));
+                    const auto c = 1 / std::sqrt(t * t + 1);
+                    const auto s = t * c;
+
+                    for (unsigned k = 0; k < N; ++k)
+                    {
+                        const auto akp = a[k, p];
+                        const auto akq = a[k, q];
+                        a[k, p] = c * akp - s * akq;
+                        a[k, q] = s * akp + c * akq;
+                    }
+
+                    for (unsigned k = 0; k < N; ++k)
+                    {
+                        const auto apk = a[p, k];
+                        const auto aqk = a[q, k];
+                        a[p, k] = c * apk - s * aqk;
+                        a[q, k] = s * apk + c * aqk;
+                    }
+
+                    for (unsigned k = 0; k < N; ++k)
+                    {
+                        const auto vkp = v[k, p];
+                        const auto vkq = v[k, q];
+                        v[k, p] = c * vkp - s * vkq;
+                        v[k, q] = s * vkp + c * vkq;
+                    }
+                }
+            }
+        }
+
+        // Selection sort on the eigenvalues, moving the columns along.
+        SymmetricEigenDecomposition<T, N> result;
+        for (unsigned i = 0; i < N; ++i)
+            result.values[i] = a[i, i];
+        for (unsigned i = 0; i < N; ++i)
+        {
+            unsigned max = i;
+            for (unsigned j = i + 1; j < N; ++j)
+            {
+                if (result.values[j] > result.values[max])
+                    max = j;
+            }
+            if (max != i)
+            {
+                std::swap(result.values[i], result.values[max]);
+                for (unsigned k = 0; k < N; ++k)
+                    std::swap(v[k, i], v[k, max]);
+            }
+        }
+        result.vectors = v;
+        return result;
+    }
+}
@@ -0,0 +1,227 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <span>
+#include "Placement.hpp"
+#include "Quaternion.hpp"
+
+namespace Xyz
+{
+    /**
+     * @brief A scale, followed by a rotation, followed by a translation.
+     *
+     * A transform holds 8 values with uniform scale, or 10 with
+     * non-uniform scale, compared to the 16 of a 4x4 matrix, and composing
+     * two transforms costs about a third of a matrix product. Convert to a
+     * matrix with affine::to_matrix when the matrix is actually needed,
+     * e.g. when uploading it to the GPU.
+     *
+     * @tparam S The scale type, either T for uniform scale or
+     *  Vector<T, 3> for non-uniform scale.
+     */
+    template <std::floating_point T, typename S = T>
+        requires std::same_as<S, T> || std::same_as<S, Vector<T, 3>>
+    struct Transform
+    {
+        using ValueType = T;
+        using ScaleType = S;
+
+        Vector<T, 3> translation;
+        /// The rotation, which must be a unit quaternion.
+        Quaternion<T> rotation;
+        ScaleType scale = ScaleType(1);
+    };
+
+    template <std::floating_point T, typename S>
+    [[nodiscard]]
+    bool operator==(const Transform<T, S>& lhs, const Transform<T, S>& rhs)
+    {
+        return lhs.translation == rhs.translation
+               && lhs.rotation == rhs.rotation
+               && lhs.scale == rhs.scale;
+    }
+
+    template <std::floating_point T, typename S>
+    [[nodiscard]]
+    bool operator!=(const Transform<T, S>& lhs, const Transform<T, S>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <std::floating_point T, typename S>
+    std::ostream& operator<<(std::ostream& os, const Transform<T, S>& t)
+    {
+        return os << "{translation: " << t.translation
+                  << ", rotation: " << t.rotation
+                  << ", scale: " << t.scale << '}';
+    }
+
+    template <std::floating_point T, typename S>
+    [[nodiscard]]
+    bool are_equal(const Transform<T, S>& lhs, const Transform<T, S>& rhs,
+                   std::type_identity_t<T> margin = Margin<T>::DEFAULT)
+    {
+        bool scale_equal;
+        if constexpr (std::same_as<S, T>)
+            scale_equal = std::abs(lhs.scale - rhs.scale) <= margin;
+        else
+            scale_equal = are_equal(lhs.scale, rhs.scale, margin);
+        return scale_equal
+               && are_equal(lhs.translation, rhs.translation, margin)
+               && are_equivalent(lhs.rotation, rhs.rotation, margin);
+    }
+
+    namespace Details
+    {
+        /**
+         * @brief Rotates @a v by the unit quaternion @a q.
+         *
+         * Transforms keep their rotations normalized, which saves the
+         * division in rotate.
+         */
+        template <std::floating_point T>
+        constexpr Vector<T, 3> rotate_unit(const Quaternion<T>& q,
+                                           const Vector<T, 3>& v)
+        {
+            const auto t = T(2) * cross(q.v, v);
+            return v + q.w * t + cross(q.v, t);
+        }
+    }
+
+    /**
+     * @brief Returns the transform that applies @a rhs first and then
+     *  @a lhs, like the product of their matrices.
+     *
+     * With non-uniform scale, the result is only exact if @a lhs has
+     * uniform scale or @a rhs has no rotation. Otherwise the product of
+     * the matrices contains a shear, which a Transform can't represent,
+     * and the shear is dropped.
+     */
+    template <std::floating_point T, typename S>
+    [[nodiscard]]
+    Transform<T, S> operator*(const Transform<T, S>& lhs,
+                              const Transform<T, S>& rhs)
+    {
+        return {
+            lhs.translation + Details::rotate_unit(lhs.rotation,
+                                                   lhs.scale * rhs.translation),
+            lhs.rotation * rhs.rotation,
+            lhs.scale * rhs.scale
+        };
+    }
+
+    /**
+     * @brief Returns the transform that undoes @a t.
+     *
+     * With non-uniform scale, the result is only exact if @a t has no
+     * rotation. Otherwise the inverse of the matrix scales along rotated
+     * axes, which a Transform can't represent.
+     *
+     * @throws XyzException if the scale of @a t is zero.
+     */
+    template <std::floating_point T, typename S>
+    [[nodiscard]]
+    Transform<T, S> invert(const Transform<T, S>& t)
+    {
+        bool is_zero;
+        if constexpr (std::same_as<S, T>)
+            is_zero = t.scale == 0;
+        else
+            is_zero = t.scale[0] == 0 || t.scale[1] == 0 || t.scale[2] == 0;
+        if (is_zero)
+            XYZ_THROW("The transform's scale is zero.");
+
+        const S inv_scale = T(1) / t.scale;
+        const auto inv_rotation = conjugate(t.rotation);
+        return {
+            -(inv_scale * Details::rotate_unit(inv_rotation, t.translation)),
+            inv_rotation,
+            inv_scale
+        };
+    }
+
+    /**
+     * @brief Returns the point @a p transformed by @a t.
+     */
+    template <std::floating_point T, typename S>
+    [[nodiscard]]
+    Vector<T, 3> transform_point(const Transform<T, S>& t, const Vector<T, 3>& p)
+    {
+        return t.translation + Details::rotate_unit(t.rotation, t.scale * p);
+    }
+
+    /**
+     * @brief Returns the vector @a v transformed by @a t, i.e. scaled and
+     *  rotated, but not translated.
+     */
+    template <std::floating_point T, typename S>
+    [[nodiscard]]
+    Vector<T, 3> transform_vector(const Transform<T, S>& t, const Vector<T, 3>& v)
+    {
+        return Details::rotate_unit(t.rotation, t.scale * v);
+    }
+
+    /**
+     * @brief Returns the transform with the same origin and orientation as
+     *  @a placement, and scale @a scale.
+     */
+    template <std::floating_point T, typename S = T>
+    [[nodiscard]]
+    Transform<T, S> make_transform(const Placement<T, 3>& placement,
+                                   const S& scale = S(1))
+    {
+        return {placement.origin, to_quaternion(placement.orientation), scale};
+    }
+
+    namespace affine
+    {
+        /**
+         * @brief Returns the transformation matrix that corresponds to
+         *  @a t.
+         */
+        template <std::floating_point T, typename S>
+        [[nodiscard]]
+        Matrix<T, 4, 4> to_matrix(const Transform<T, S>& t)
+        {
+            const auto r = linear::to_matrix(t.rotation);
+            Vector<T, 3> s;
+            if constexpr (std::same_as<S, T>)
+                s = {t.scale, t.scale, t.scale};
+            else
+                s = t.scale;
+            // The product of the rotation matrix and a diagonal scale
+            // matrix, i.e. the rotation matrix with scaled columns.
+            return {
+                r[0, 0] * s[0], r[0, 1] * s[1], r[0, 2] * s[2], t.translation[0],
+                r[1, 0] * s[0], r[1, 1] * s[1], r[1, 2] * s[2], t.translation[1],
+                r[2, 0] * s[0], r[2, 1] * s[1], r[2, 2] * s[2], t.translation[2],
+                0, 0, 0, 1
+            };
+        }
+
+        /**
+         * @brief Converts every transform in @a transforms to a matrix and
+         *  writes it to @a result.
+         *
+         * @throws XyzException if @a result is smaller than @a transforms.
+         */
+        template <std::floating_point T, typename S = T>
+        void to_matrix(std::type_identity_t<std::span<const Transform<T, S>>> transforms,
+                       std::span<Matrix<T, 4, 4>> result)
+        {
+            if (result.size() < transforms.size())
+                XYZ_THROW("The result span is smaller than the transforms span.");
+
+            for (size_t i = 0; i < transforms.size(); ++i)
+                result[i] = to_matrix(transforms[i]);
+        }
+    }
+
+    using TransformF = Transform<float>;
+    using TransformD = Transform<double>;
+}
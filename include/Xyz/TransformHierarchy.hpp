@@ -0,0 +1,286 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "InvertMatrix.hpp"
+#include "Matrix.hpp"
+#include "Parallel.hpp"
+#include "XyzException.hpp"
+
+namespace Xyz
+{
+    /**
+     * @brief A hierarchy of nodes with local transformation matrices,
+     *  whose world matrices are the product of the local matrices of the
+     *  node and all its ancestors.
+     *
+     * The nodes are stored in topological order, i.e. every node's parent
+     * has a lower index than the node itself. Changing a node's local
+     * matrix marks it as dirty, and update recomputes the world matrices
+     * of the dirty nodes and their descendants only.
+     *
+     * update processes the hierarchy one level at a time: first all the
+     * dirty nodes whose parents are roots, then their children, and so on.
+     * The nodes within a level are independent of each other, which means
+     * each level can be processed as a single batch, and split between
+     * several threads.
+     */
+    template <std::floating_point T>
+    class TransformHierarchy
+    {
+    public:
+        using NodeIndex = uint32_t;
+
+        /// The parent of the root nodes.
+        static constexpr NodeIndex NO_PARENT = ~NodeIndex(0);
+
+        TransformHierarchy() = default;
+
+        /**
+         * @brief Creates a hierarchy with a node for each entry in
+         *  @a parents, all with identity matrices.
+         *
+         * @throws XyzException if a parent index isn't NO_PARENT or less
+         *  than the index of the node itself.
+         */
+        explicit TransformHierarchy(std::span<const NodeIndex> parents)
+        {
+            reserve(parents.size());
+            for (auto parent : parents)
+                add_node(parent);
+        }
+
+        void reserve(size_t node_count)
+        {
+            parents_.reserve(node_count);
+            levels_.reserve(node_count);
+            local_matrices_.reserve(node_count);
+            world_matrices_.reserve(node_count);
+            dirty_.reserve(node_count);
+        }
+
+        /**
+         * @brief Adds a node with parent @a parent and local matrix
+         *  @a local_matrix, and returns its index.
+         *
+         * @throws XyzException if @a parent isn't NO_PARENT or the index
+         *  of an existing node.
+         */
+        NodeIndex add_node(NodeIndex parent,
+                           const Matrix<T, 4, 4>& local_matrix
+                               = make_identity_matrix<T, 4>())
+        {
+            if (parent != NO_PARENT && parent >= parents_.size())
+                XYZ_THROW("The parent index is out of range.");
+            if (parents_.size() >= NO_PARENT)
+                XYZ_THROW("The hierarchy is full.");
+
+            const auto index = NodeIndex(parents_.size());
+            const auto level = parent == NO_PARENT ? 0u : levels_[parent] + 1;
+            parents_.push_back(parent);
+            levels_.push_back(level);
+            local_matrices_.push_back(local_matrix);
+            world_matrices_.push_back(local_matrix);
+            dirty_.push_back(1);
+            has_dirty_nodes_ = true;
+            levels_are_sorted_ = false;
+            return index;
+        }
+
+        [[nodiscard]] size_t size() const
+        {
+            return parents_.size();
+        }
+
+        [[nodiscard]] NodeIndex parent(NodeIndex node) const
+        {
+            return parents_[node];
+        }
+
+        /**
+         * @brief Returns the number of ancestors of @a node.
+         */
+        [[nodiscard]] unsigned level(NodeIndex node) const
+        {
+            return levels_[node];
+        }
+
+        [[nodiscard]] const Matrix<T, 4, 4>& local_matrix(NodeIndex node) const
+        {
+            return local_matrices_[node];
+        }
+
+        /**
+         * @brief Sets the local matrix of @a node and marks it as dirty.
+         */
+        void set_local_matrix(NodeIndex node, const Matrix<T, 4, 4>& m)
+        {
+            local_matrices_[node] = m;
+            dirty_[node] = 1;
+            has_dirty_nodes_ = true;
+        }
+
+        /**
+         * @brief Returns true if the local matrix of @a node has changed
+         *  since the last call to update.
+         *
+         * A node whose ancestor has changed isn't dirty itself, but its
+         * world matrix is updated all the same.
+         */
+        [[nodiscard]] bool is_dirty(NodeIndex node) const
+        {
+            return dirty_[node] != 0;
+        }
+
+        /**
+         * @brief Returns the world matrix of @a node as of the last call
+         *  to update.
+         */
+        [[nodiscard]] const Matrix<T, 4, 4>& world_matrix(NodeIndex node) const
+        {
+            return world_matrices_[node];
+        }
+
+        /**
+         * @brief Returns the world matrices of all the nodes as of the last
+         *  call to update.
+         */
+        [[nodiscard]] std::span<const Matrix<T, 4, 4>> world_matrices() const
+        {
+            return world_matrices_;
+        }
+
+        /**
+         * @brief Returns the inverse of the world matrix of @a node, which
+         *  must be an invertible affine matrix.
+         */
+        [[nodiscard]] Matrix<T, 4, 4> inverse_world_matrix(NodeIndex node) const
+        {
+            return affine::invert(world_matrices_[node]);
+        }
+
+        /**
+         * @brief Recomputes the world matrices of the dirty nodes and all
+         *  their descendants, and returns the number of recomputed nodes.
+         *
+         * @param thread_count The number of threads each level is split
+         *  between, 0 means one per hardware thread. Levels with few dirty
+         *  nodes are always processed by the calling thread only.
+         */
+        size_t update(unsigned thread_count = 1)
+        {
+            if (!has_dirty_nodes_)
+                return 0;
+
+            sort_levels();
+
+            size_t count = 0;
+            for (size_t level = 0; level + 1 < level_offsets_.size(); ++level)
+            {
+                // Collect this level's dirty nodes, and pass their dirty
+                // flags on to their children in the next level.
+                batch_.clear();
+                for (auto i = level_offsets_[level]; i < level_offsets_[level + 1]; ++i)
+                {
+                    const auto node = nodes_by_level_[i];
+                    const auto parent = parents_[node];
+                    if (dirty_[node] || (parent != NO_PARENT && dirty_[parent]))
+                    {
+                        dirty_[node] = 1;
+                        batch_.push_back(node);
+                    }
+                }
+
+                Details::parallel_for(
+                    batch_.size(), thread_count, MIN_CHUNK_SIZE,
+                    [&](size_t, size_t begin, size_t end)
+                    {
+                        update_world_matrices(begin, end);
+                    });
+                count += batch_.size();
+
+                // The previous level's flags are no longer needed.
+                if (level != 0)
+                    clear_dirty_flags(level - 1);
+            }
+
+            if (level_offsets_.size() >= 2)
+                clear_dirty_flags(level_offsets_.size() - 2);
+            has_dirty_nodes_ = false;
+            return count;
+        }
+
+    private:
+        /// The smallest number of nodes that is worth a thread of its own.
+        static constexpr size_t MIN_CHUNK_SIZE = 1024;
+
+        void update_world_matrices(size_t begin, size_t end)
+        {
+            for (auto i = begin; i < end; ++i)
+            {
+                const auto node = batch_[i];
+                const auto parent = parents_[node];
+                if (parent == NO_PARENT)
+                    world_matrices_[node] = local_matrices_[node];
+                else
+                    world_matrices_[node] = world_matrices_[parent]
+                                            * local_matrices_[node];
+            }
+        }
+
+        void clear_dirty_flags(size_t level)
+        {
+            for (auto i = level_offsets_[level]; i < level_offsets_[level + 1]; ++i)
+                dirty_[nodes_by_level_[i]] = 0;
+        }
+
+        /**
+         * @brief Sorts the node indexes by level with a counting sort, if
+         *  nodes have been added since the last time.
+         */
+        void sort_levels()
+        {
+            if (levels_are_sorted_)
+                return;
+
+            level_offsets_.clear();
+            for (auto level : levels_)
+            {
+                if (level + 2 > level_offsets_.size())
+                    level_offsets_.resize(level + 2, 0);
+                ++level_offsets_[level + 1];
+            }
+            for (size_t i = 1; i < level_offsets_.size(); ++i)
+                level_offsets_[i] += level_offsets_[i - 1];
+
+            nodes_by_level_.resize(levels_.size());
+            auto next = level_offsets_;
+            for (size_t node = 0; node < levels_.size(); ++node)
+                nodes_by_level_[next[levels_[node]]++] = NodeIndex(node);
+
+            levels_are_sorted_ = true;
+        }
+
+        std::vector<NodeIndex> parents_;
+        std::vector<unsigned> levels_;
+        std::vector<Matrix<T, 4, 4>> local_matrices_;
+        std::vector<Matrix<T, 4, 4>> world_matrices_;
+        std::vector<uint8_t> dirty_;
+        bool has_dirty_nodes_ = false;
+
+        /// The node indexes sorted by level, and where each level starts.
+        std::vector<NodeIndex> nodes_by_level_;
+        std::vector<size_t> level_offsets_;
+        bool levels_are_sorted_ = true;
+
+        /// The dirty nodes in the level that is being updated.
+        std::vector<NodeIndex> batch_;
+    };
+}
@@ -8,6 +8,8 @@
 #pragma once
 
 #include "Approx.hpp"
+#include "FloatType.hpp"
+#include "Predicates.hpp"
 #include "Vector.hpp"
 
 namespace Xyz
@@ -65,43 +67,100 @@ namespace Xyz
         return std::sqrt(get_area_squared(triangle));
     }
 
+    /**
+     * @brief Returns true if @a point is inside @a triangle and more than
+     *  @a margin away from its edges.
+     *
+     * The corners of @a triangle must be in counterclockwise order. The
+     * margin applies to the cross product of each edge and the vector
+     * from its start to @a point, i.e. it is scaled by the edge's length.
+     */
     template <typename T, typename U,
               typename Float = FloatType<decltype(T() + U())>::type>
     [[nodiscard]]
     bool contains_point(const Triangle<T, 2>& triangle,
                         const Vector<U, 2>& point,
-                        Float margin = Margin<Float>::DEFAULT)
+                        Float margin)
     {
         auto a = dot(get_normal(triangle[1] - triangle[0]),
                      point - triangle[0]);
-        if (Xyz::Approx<Float>(a, margin) <= 0)
+        if (a <= margin)
             return false;
         auto b = dot(get_normal(triangle[2] - triangle[1]),
                      point - triangle[1]);
-        if (Xyz::Approx<Float>(b, margin) <= 0)
+        if (b <= margin)
             return false;
         auto c = dot(get_normal(triangle[0] - triangle[2]),
                      point - triangle[2]);
-        return Xyz::Approx<Float>(c, margin) > 0;
+        return c > margin;
     }
 
+    /**
+     * @brief Returns true if @a point is inside @a triangle or less than
+     *  @a margin away from its edges.
+     *
+     * The corners of @a triangle must be in counterclockwise order. The
+     * margin is applied as in contains_point.
+     */
     template <typename T, typename U,
               typename Float = FloatType<decltype(T() + U())>::type>
     [[nodiscard]]
     bool contains_point_inclusive(const Triangle<T, 2>& triangle,
                                   const Vector<U, 2>& point,
-                                  Float margin = Margin<Float>::DEFAULT)
+                                  Float margin)
     {
         auto a = dot(get_normal(triangle[1] - triangle[0]),
                      point - triangle[0]);
-        if (Xyz::Approx<Float>(a, margin) < 0)
+        if (a < -margin)
             return false;
         auto b = dot(get_normal(triangle[2] - triangle[1]),
                      point - triangle[1]);
-        if (Xyz::Approx<Float>(b, margin) < 0)
+        if (b < -margin)
             return false;
         auto c = dot(get_normal(triangle[0] - triangle[2]),
                      point - triangle[2]);
-        return Xyz::Approx<Float>(c, margin) >= 0;
+        return c >= -margin;
+    }
+
+    /**
+     * @brief Returns true if @a point is strictly inside @a triangle.
+     *
+     * The corners of @a triangle must be in counterclockwise order. The
+     * test uses orient2d, and is exact for the coordinates converted to
+     * double, even for points that are extremely close to an edge.
+     */
+    template <typename T, typename U>
+    [[nodiscard]]
+    bool contains_point(const Triangle<T, 2>& triangle,
+                        const Vector<U, 2>& point)
+    {
+        const auto p = vector_cast<double>(point);
+        const auto t0 = vector_cast<double>(triangle[0]);
+        const auto t1 = vector_cast<double>(triangle[1]);
+        const auto t2 = vector_cast<double>(triangle[2]);
+        return orient2d(t0, t1, p) > 0
+               && orient2d(t1, t2, p) > 0
+               && orient2d(t2, t0, p) > 0;
+    }
+
+    /**
+     * @brief Returns true if @a point is inside @a triangle or on one of
+     *  its edges.
+     *
+     * The corners of @a triangle must be in counterclockwise order. The
+     * test is exact, as for contains_point.
+     */
+    template <typename T, typename U>
+    [[nodiscard]]
+    bool contains_point_inclusive(const Triangle<T, 2>& triangle,
+                                  const Vector<U, 2>& point)
+    {
+        const auto p = vector_cast<double>(point);
+        const auto t0 = vector_cast<double>(triangle[0]);
+        const auto t1 = vector_cast<double>(triangle[1]);
+        const auto t2 = vector_cast<double>(triangle[2]);
+        return orient2d(t0, t1, p) >= 0
+               && orient2d(t1, t2, p) >= 0
+               && orient2d(t2, t0, p) >= 0;
     }
 }
@@ -0,0 +1,215 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include "Constants.hpp"
+
+namespace Xyz
+{
+    /**
+     * @brief Selects between the standard library's trigonometric
+     *  functions and the faster polynomial approximations in this file.
+     */
+    enum class TrigPrecision
+    {
+        /// std::sin, std::cos, std::atan2 and std::asin.
+        STANDARD,
+        /// fast_sincos, fast_atan2 and fast_asin.
+        FAST
+    };
+
+    template <std::floating_point T>
+    struct SinCos
+    {
+        T sin;
+        T cos;
+    };
+
+    /**
+     * @brief Returns the sine and cosine of @a angle.
+     *
+     * Computing the two together lets the compiler replace them with a
+     * single call that shares the range reduction.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    SinCos<T> sincos(T angle)
+    {
+        return {std::sin(angle), std::cos(angle)};
+    }
+
+    namespace Details
+    {
+        /**
+         * @brief Evaluates the polynomial with coefficients @a coeffs,
+         *  highest degree first, at @a x with Horner's method.
+         */
+        template <std::floating_point T, size_t N>
+        constexpr T evaluate_polynomial(const T (&coeffs)[N], T x)
+        {
+            auto result = coeffs[0];
+            for (size_t i = 1; i < N; ++i)
+                result = result * x + coeffs[i];
+            return result;
+        }
+    }
+
+    /**
+     * @brief Returns the sine and cosine of @a angle, computed with
+     *  polynomials rather than the standard library.
+     *
+     * The angle is reduced to the range [-PI/4, PI/4] around the nearest
+     * multiple of PI/2, where the sine and cosine are given by their
+     * Taylor polynomials of degree 11 and 12. For angles with magnitude up
+     * to 10^5, the largest absolute error is less than 1e-11 for double
+     * and 1e-7 for float. The error grows for larger angles, as the range
+     * reduction loses precision.
+     *
+     * Whether this is faster than sincos depends on the standard library.
+     * glibc's single precision sine and cosine are hard to beat, while the
+     * double precision ones are somewhat slower than this function.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    SinCos<T> fast_sincos(T angle)
+    {
+        // PI/2 split in two, so that q * PIO2_HI is exact for moderate q.
+        constexpr double PIO2_HI = 1.57079632673412561417e+00;
+        constexpr double PIO2_LO = 6.07710050650619224932e-11;
+        constexpr double TWO_OVER_PI = 6.36619772367581382433e-01;
+
+        const auto x = double(angle);
+        const auto q = std::floor(x * TWO_OVER_PI + 0.5);
+        const auto r = T((x - q * PIO2_HI) - q * PIO2_LO);
+        const auto r2 = r * r;
+
+        // Taylor coefficients, highest degree first.
+        constexpr T SIN[] = {T(-1.0 / 39916800), T(1.0 / 362880),
+                             T(-1.0 / 5040), T(1.0 / 120), T(-1.0 / 6), T(1)};
+        constexpr T COS[] = {T(1.0 / 479001600), T(-1.0 / 3628800),
+                             T(1.0 / 40320), T(-1.0 / 720), T(1.0 / 24),
+                             T(-0.5), T(1)};
+        const auto s = r * Details::evaluate_polynomial(SIN, r2);
+        const auto c = Details::evaluate_polynomial(COS, r2);
+
+        switch (int64_t(q) & 3)
+        {
+        case 0:
+            return {s, c};
+        case 1:
+            return {c, -s};
+        case 2:
+            return {-s, -c};
+        default:
+            return {-c, s};
+        }
+    }
+
+    namespace Details
+    {
+        /**
+         * @brief Returns the arctangent of @a t in the range [0, 1].
+         */
+        template <std::floating_point T>
+        T fast_atan_unit(T t)
+        {
+            // Beyond tan(PI/8), use atan(t) = PI/4 + atan((t - 1) / (t + 1)),
+            // so the Taylor polynomial is only evaluated for
+            // |t| <= tan(PI/8), where it converges quickly.
+            constexpr auto TAN_PI_8 = T(0.41421356237309504880);
+            T offset = 0;
+            if (t > TAN_PI_8)
+            {
+                t = (t - 1) / (t + 1);
+                offset = T(Constants<T>::PI / 4);
+            }
+
+            // atan(t) = t - t^3/3 + t^5/5 - ... + t^21/21
+            constexpr T ATAN[] = {T(1.0 / 21), T(-1.0 / 19), T(1.0 / 17),
+                                  T(-1.0 / 15), T(1.0 / 13), T(-1.0 / 11),
+                                  T(1.0 / 9), T(-1.0 / 7), T(1.0 / 5),
+                                  T(-1.0 / 3), T(1)};
+            return offset + t * evaluate_polynomial(ATAN, t * t);
+        }
+    }
+
+    /**
+     * @brief Returns the angle of the vector (@a x, @a y) in the range
+     *  [-PI, PI], computed with polynomials rather than the standard
+     *  library.
+     *
+     * The largest absolute error is less than 1e-10 for double and 5e-7
+     * for float. Unlike std::atan2, the sign of zero is ignored, and
+     * fast_atan2(0, 0) is 0.
+     *
+     * Whether this is faster than std::atan2 depends on the standard
+     * library.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    T fast_atan2(T y, T x)
+    {
+        constexpr auto PI = T(Constants<T>::PI);
+        const auto ax = std::abs(x);
+        const auto ay = std::abs(y);
+        if (ax == 0 && ay == 0)
+            return 0;
+
+        auto a = ay <= ax ? Details::fast_atan_unit(ay / ax)
+                          : PI / 2 - Details::fast_atan_unit(ax / ay);
+        if (x < 0)
+            a = PI - a;
+        return y < 0 ? -a : a;
+    }
+
+    /**
+     * @brief Returns the arcsine of @a x, which must be in the range
+     *  [-1, 1], computed with polynomials rather than the standard library.
+     *
+     * The error is the same as for fast_atan2.
+     */
+    template <std::floating_point T>
+    [[nodiscard]]
+    T fast_asin(T x)
+    {
+        return fast_atan2(x, std::sqrt((1 - x) * (1 + x)));
+    }
+
+    namespace Details
+    {
+        template <TrigPrecision P, std::floating_point T>
+        SinCos<T> get_sincos(T angle)
+        {
+            if constexpr (P == TrigPrecision::FAST)
+                return fast_sincos(angle);
+            else
+                return sincos(angle);
+        }
+
+        template <TrigPrecision P, std::floating_point T>
+        T get_atan2(T y, T x)
+        {
+            if constexpr (P == TrigPrecision::FAST)
+                return fast_atan2(y, x);
+            else
+                return std::atan2(y, x);
+        }
+
+        template <TrigPrecision P, std::floating_point T>
+        T get_asin(T x)
+        {
+            if constexpr (P == TrigPrecision::FAST)
+                return fast_asin(x);
+            else
+                return std::asin(x);
+        }
+    }
+}
@@ -9,22 +9,44 @@
 
 #include "BBox.hpp"
 #include "ComplexApprox.hpp"
+#include "DualQuaternion.hpp"
+#include "FitOrientedCuboid.hpp"
+#include "Frustum.hpp"
 #include "OrientedCuboid.hpp"
+#include "OrientedCuboidIntersection.hpp"
 #include "Interpolation.hpp"
 #include "Line.hpp"
 #include "LineClipper.hpp"
 #include "LineLineIntersection.hpp"
 #include "LineSegment.hpp"
+#include "LineString.hpp"
 #include "Matrix.hpp"
+#include "Mesh/AttributeEncoding.hpp"
 #include "Mesh/BuildMesh.hpp"
+#include "Mesh/HalfEdgeMesh.hpp"
+#include "Mesh/Heightfield.hpp"
+#include "Mesh/OptimizeVertexCache.hpp"
+#include "Mesh/PagedMeshBuilder.hpp"
+#include "Mesh/Primitives.hpp"
+#include "Mesh/WeldVertexes.hpp"
 #include "Pgram.hpp"
+#include "PointStatistics.hpp"
+#include "Predicates.hpp"
 #include "ProjectionMatrix.hpp"
 #include "QuadraticEquation.hpp"
 #include "Quaternion.hpp"
+#include "QuaternionInterpolation.hpp"
 #include "RandomNumberGenerator.hpp"
+#include "SegmentIntersections.hpp"
+#include "SimplexNoise.hpp"
+#include "Sphere.hpp"
 #include "SphericalPoint.hpp"
+#include "SymmetricEigenDecomposition.hpp"
+#include "Transform.hpp"
 #include "TransformationMatrix.hpp"
+#include "TransformHierarchy.hpp"
 #include "Triangle.hpp"
+#include "Trigonometry.hpp"
 #include "Utilities.hpp"
 #include "Vector.hpp"
 #include "XyzVersion.hpp"
@@ -0,0 +1,417 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Xyz/Predicates.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace Xyz
+{
+    namespace
+    {
+        /// Half the distance between 1 and the next double, 2^-53.
+        constexpr double EPSILON = 0x1p-53;
+
+        // Bounds on the relative rounding errors of the determinants when
+        // they are evaluated with double arithmetic, from Shewchuk's paper.
+        constexpr double ORIENT2D_ERROR_BOUND = (3.0 + 16.0 * EPSILON) * EPSILON;
+        constexpr double ORIENT3D_ERROR_BOUND = (7.0 + 56.0 * EPSILON) * EPSILON;
+        constexpr double INCIRCLE_ERROR_BOUND = (10.0 + 96.0 * EPSILON) * EPSILON;
+        constexpr double INSPHERE_ERROR_BOUND = (16.0 + 224.0 * EPSILON) * EPSILON;
+
+        /**
+         * @brief An exact number represented as the sum of doubles that
+         *  don't overlap, ordered by increasing magnitude.
+         *
+         * Zero components are removed, except that zero itself is a
+         * single zero component.
+         */
+        class Expansion
+        {
+        public:
+            Expansion(double value = 0)
+                : terms_{value}
+            {}
+
+            [[nodiscard]] double sign() const
+            {
+                const auto value = terms_.back();
+                return value > 0 ? 1.0 : (value < 0 ? -1.0 : 0.0);
+            }
+
+            friend Expansion operator+(const Expansion& a, const Expansion& b);
+            friend Expansion operator*(const Expansion& a, double b);
+            friend Expansion operator*(const Expansion& a, const Expansion& b);
+            friend Expansion operator-(const Expansion& a);
+
+            static Expansion difference(double a, double b);
+
+        private:
+            explicit Expansion(std::vector<double> terms)
+                : terms_(std::move(terms))
+            {
+                if (terms_.empty())
+                    terms_.push_back(0);
+            }
+
+            std::vector<double> terms_;
+        };
+
+        /**
+         * @brief Returns x and y such that x + y == a + b exactly and
+         *  x is a + b rounded. Requires |a| >= |b|.
+         */
+        std::pair<double, double> fast_two_sum(double a, double b)
+        {
+            const auto x = a + b;
+            return {x, b - (x - a)};
+        }
+
+        /**
+         * @brief Returns x and y such that x + y == a + b exactly and
+         *  x is a + b rounded.
+         */
+        std::pair<double, double> two_sum(double a, double b)
+        {
+            const auto x = a + b;
+            const auto b_virtual = x - a;
+            const auto a_virtual = x - b_virtual;
+            return {x, (a - a_virtual) + (b - b_virtual)};
+        }
+
+        /**
+         * @brief Returns x and y such that x + y == a * b exactly and
+         *  x is a * b rounded.
+         */
+        std::pair<double, double> two_product(double a, double b)
+        {
+            const auto x = a * b;
+            return {x, std::fma(a, b, -x)};
+        }
+
+        Expansion Expansion::difference(double a, double b)
+        {
+            const auto [x, y] = two_sum(a, -b);
+            if (y == 0)
+                return {x};
+            return Expansion(std::vector<double>{y, x});
+        }
+
+        /**
+         * @brief Shewchuk's FAST-EXPANSION-SUM with zero elimination.
+         */
+        Expansion operator+(const Expansion& a, const Expansion& b)
+        {
+            const auto& e = a.terms_;
+            const auto& f = b.terms_;
+            std::vector<double> h;
+            h.reserve(e.size() + f.size());
+
+            size_t i = 0, j = 0;
+            // Returns the smaller of the next terms in e and f.
+            const auto next = [&]
+            {
+                if (j == f.size()
+                    || (i < e.size() && std::abs(e[i]) < std::abs(f[j])))
+                {
+                    return e[i++];
+                }
+                return f[j++];
+            };
+
+            auto q = next();
+            if (i < e.size() && j < f.size())
+            {
+                double hh;
+                std::tie(q, hh) = fast_two_sum(next(), q);
+                if (hh != 0)
+                    h.push_back(hh);
+            }
+            while (i < e.size() || j < f.size())
+            {
+                double hh;
+                std::tie(q, hh) = two_sum(q, next());
+                if (hh != 0)
+                    h.push_back(hh);
+            }
+            if (q != 0 || h.empty())
+                h.push_back(q);
+            return Expansion(std::move(h));
+        }
+
+        /**
+         * @brief Shewchuk's SCALE-EXPANSION with zero elimination.
+         */
+        Expansion operator*(const Expansion& a, double b)
+        {
+            const auto& e = a.terms_;
+            std::vector<double> h;
+            h.reserve(2 * e.size());
+
+            auto [q, hh] = two_product(e[0], b);
+            if (hh != 0)
+                h.push_back(hh);
+            for (size_t i = 1; i < e.size(); ++i)
+            {
+                const auto [product1, product0] = two_product(e[i], b);
+                double sum;
+                std::tie(sum, hh) = two_sum(q, product0);
+                if (hh != 0)
+                    h.push_back(hh);
+                std::tie(q, hh) = fast_two_sum(product1, sum);
+                if (hh != 0)
+                    h.push_back(hh);
+            }
+            if (q != 0 || h.empty())
+                h.push_back(q);
+            return Expansion(std::move(h));
+        }
+
+        Expansion operator*(const Expansion& a, const Expansion& b)
+        {
+            Expansion result = a * b.terms_[0];
+            for (size_t i = 1; i < b.terms_.size(); ++i)
+                result = result + a * b.terms_[i];
+            return result;
+        }
+
+        Expansion operator-(const Expansion& a)
+        {
+            auto terms = a.terms_;
+            for (auto& term : terms)
+                term = -term;
+            return Expansion(std::move(terms));
+        }
+
+        Expansion operator-(const Expansion& a, const Expansion& b)
+        {
+            return a + -b;
+        }
+
+        /**
+         * @brief Returns the exact differences between the coordinates of
+         *  @a p and @a origin.
+         */
+        template <unsigned N>
+        std::array<Expansion, N> get_differences(const Vector<double, N>& p,
+                                                 const Vector<double, N>& origin)
+        {
+            std::array<Expansion, N> result;
+            for (unsigned i = 0; i < N; ++i)
+                result[i] = Expansion::difference(p[i], origin[i]);
+            return result;
+        }
+
+        double orient2d_exact(const Vector<double, 2>& a,
+                              const Vector<double, 2>& b,
+                              const Vector<double, 2>& c)
+        {
+            const auto [acx, acy] = get_differences(a, c);
+            const auto [bcx, bcy] = get_differences(b, c);
+            return (acx * bcy - acy * bcx).sign();
+        }
+
+        double orient3d_exact(const Vector<double, 3>& a,
+                              const Vector<double, 3>& b,
+                              const Vector<double, 3>& c,
+                              const Vector<double, 3>& d)
+        {
+            const auto [adx, ady, adz] = get_differences(a, d);
+            const auto [bdx, bdy, bdz] = get_differences(b, d);
+            const auto [cdx, cdy, cdz] = get_differences(c, d);
+            return (adz * (bdx * cdy - cdx * bdy)
+                    + bdz * (cdx * ady - adx * cdy)
+                    + cdz * (adx * bdy - bdx * ady)).sign();
+        }
+
+        double incircle_exact(const Vector<double, 2>& a,
+                              const Vector<double, 2>& b,
+                              const Vector<double, 2>& c,
+                              const Vector<double, 2>& d)
+        {
+            const auto [adx, ady] = get_differences(a, d);
+            const auto [bdx, bdy] = get_differences(b, d);
+            const auto [cdx, cdy] = get_differences(c, d);
+            const auto alift = adx * adx + ady * ady;
+            const auto blift = bdx * bdx + bdy * bdy;
+            const auto clift = cdx * cdx + cdy * cdy;
+            return (alift * (bdx * cdy - cdx * bdy)
+                    + blift * (cdx * ady - adx * cdy)
+                    + clift * (adx * bdy - bdx * ady)).sign();
+        }
+
+        double insphere_exact(const Vector<double, 3>& a,
+                              const Vector<double, 3>& b,
+                              const Vector<double, 3>& c,
+                              const Vector<double, 3>& d,
+                              const Vector<double, 3>& e)
+        {
+            const auto [aex, aey, aez] = get_differences(a, e);
+            const auto [bex, bey, bez] = get_differences(b, e);
+            const auto [cex, cey, cez] = get_differences(c, e);
+            const auto [dex, dey, dez] = get_differences(d, e);
+
+            const auto ab = aex * bey - bex * aey;
+            const auto bc = bex * cey - cex * bey;
+            const auto cd = cex * dey - dex * cey;
+            const auto da = dex * aey - aex * dey;
+            const auto ac = aex * cey - cex * aey;
+            const auto bd = bex * dey - dex * bey;
+
+            const auto abc = aez * bc - bez * ac + cez * ab;
+            const auto bcd = bez * cd - cez * bd + dez * bc;
+            const auto cda = cez * da + dez * ac + aez * cd;
+            const auto dab = dez * ab + aez * bd + bez * da;
+
+            const auto alift = aex * aex + aey * aey + aez * aez;
+            const auto blift = bex * bex + bey * bey + bez * bez;
+            const auto clift = cex * cex + cey * cey + cez * cez;
+            const auto dlift = dex * dex + dey * dey + dez * dez;
+
+            return ((dlift * abc - clift * dab)
+                    + (blift * cda - alift * bcd)).sign();
+        }
+    }
+
+    double orient2d(const Vector<double, 2>& a,
+                    const Vector<double, 2>& b,
+                    const Vector<double, 2>& c)
+    {
+        const auto left = (a[0] - c[0]) * (b[1] - c[1]);
+        const auto right = (a[1] - c[1]) * (b[0] - c[0]);
+        const auto det = left - right;
+        const auto bound = ORIENT2D_ERROR_BOUND * (std::abs(left) + std::abs(right));
+        if (std::abs(det) > bound)
+            return det;
+        return orient2d_exact(a, b, c) * std::max(std::abs(det), bound);
+    }
+
+    double orient3d(const Vector<double, 3>& a,
+                    const Vector<double, 3>& b,
+                    const Vector<double, 3>& c,
+                    const Vector<double, 3>& d)
+    {
+        const auto ad = a - d;
+        const auto bd = b - d;
+        const auto cd = c - d;
+
+        const auto bdx_cdy = bd[0] * cd[1];
+        const auto cdx_bdy = cd[0] * bd[1];
+        const auto cdx_ady = cd[0] * ad[1];
+        const auto adx_cdy = ad[0] * cd[1];
+        const auto adx_bdy = ad[0] * bd[1];
+        const auto bdx_ady = bd[0] * ad[1];
+
+        const auto det = ad[2] * (bdx_cdy - cdx_bdy)
+                         + bd[2] * (cdx_ady - adx_cdy)
+                         + cd[2] * (adx_bdy - bdx_ady);
+        const auto permanent
+            = (std::abs(bdx_cdy) + std::abs(cdx_bdy)) * std::abs(ad[2])
+              + (std::abs(cdx_ady) + std::abs(adx_cdy)) * std::abs(bd[2])
+              + (std::abs(adx_bdy) + std::abs(bdx_ady)) * std::abs(cd[2]);
+        const auto bound = ORIENT3D_ERROR_BOUND * permanent;
+        if (std::abs(det) > bound)
+            return det;
+        return orient3d_exact(a, b, c, d) * std::max(std::abs(det), bound);
+    }
+
+    double incircle(const Vector<double, 2>& a,
+                    const Vector<double, 2>& b,
+                    const Vector<double, 2>& c,
+                    const Vector<double, 2>& d)
+    {
+        const auto ad = a - d;
+        const auto bd = b - d;
+        const auto cd = c - d;
+
+        const auto bdx_cdy = bd[0] * cd[1];
+        const auto cdx_bdy = cd[0] * bd[1];
+        const auto cdx_ady = cd[0] * ad[1];
+        const auto adx_cdy = ad[0] * cd[1];
+        const auto adx_bdy = ad[0] * bd[1];
+        const auto bdx_ady = bd[0] * ad[1];
+
+        const auto alift = ad[0] * ad[0] + ad[1] * ad[1];
+        const auto blift = bd[0] * bd[0] + bd[1] * bd[1];
+        const auto clift = cd[0] * cd[0] + cd[1] * cd[1];
+
+        const auto det = alift * (bdx_cdy - cdx_bdy)
+                         + blift * (cdx_ady - adx_cdy)
+                         + clift * (adx_bdy - bdx_ady);
+        const auto permanent
+            = (std::abs(bdx_cdy) + std::abs(cdx_bdy)) * alift
+              + (std::abs(cdx_ady) + std::abs(adx_cdy)) * blift
+              + (std::abs(adx_bdy) + std::abs(bdx_ady)) * clift;
+        const auto bound = INCIRCLE_ERROR_BOUND * permanent;
+        if (std::abs(det) > bound)
+            return det;
+        return incircle_exact(a, b, c, d) * std::max(std::abs(det), bound);
+    }
+
+    double insphere(const Vector<double, 3>& a,
+                    const Vector<double, 3>& b,
+                    const Vector<double, 3>& c,
+                    const Vector<double, 3>& d,
+                    const Vector<double, 3>& e)
+    {
+        const auto ae = a - e;
+        const auto be = b - e;
+        const auto ce = c - e;
+        const auto de = d - e;
+
+        const auto aex_bey = ae[0] * be[1], bex_aey = be[0] * ae[1];
+        const auto bex_cey = be[0] * ce[1], cex_bey = ce[0] * be[1];
+        const auto cex_dey = ce[0] * de[1], dex_cey = de[0] * ce[1];
+        const auto dex_aey = de[0] * ae[1], aex_dey = ae[0] * de[1];
+        const auto aex_cey = ae[0] * ce[1], cex_aey = ce[0] * ae[1];
+        const auto bex_dey = be[0] * de[1], dex_bey = de[0] * be[1];
+
+        const auto ab = aex_bey - bex_aey;
+        const auto bc = bex_cey - cex_bey;
+        const auto cd = cex_dey - dex_cey;
+        const auto da = dex_aey - aex_dey;
+        const auto ac = aex_cey - cex_aey;
+        const auto bd = bex_dey - dex_bey;
+
+        const auto abc = ae[2] * bc - be[2] * ac + ce[2] * ab;
+        const auto bcd = be[2] * cd - ce[2] * bd + de[2] * bc;
+        const auto cda = ce[2] * da + de[2] * ac + ae[2] * cd;
+        const auto dab = de[2] * ab + ae[2] * bd + be[2] * da;
+
+        const auto alift = get_length_squared(ae);
+        const auto blift = get_length_squared(be);
+        const auto clift = get_length_squared(ce);
+        const auto dlift = get_length_squared(de);
+
+        const auto det = (dlift * abc - clift * dab) + (blift * cda - alift * bcd);
+
+        // The permanent is the determinant's expression with the absolute
+        // values of all the products.
+        const auto abp = std::abs(aex_bey) + std::abs(bex_aey);
+        const auto bcp = std::abs(bex_cey) + std::abs(cex_bey);
+        const auto cdp = std::abs(cex_dey) + std::abs(dex_cey);
+        const auto dap = std::abs(dex_aey) + std::abs(aex_dey);
+        const auto acp = std::abs(aex_cey) + std::abs(cex_aey);
+        const auto bdp = std::abs(bex_dey) + std::abs(dex_bey);
+        const auto aez = std::abs(ae[2]), bez = std::abs(be[2]);
+        const auto cez = std::abs(ce[2]), dez = std::abs(de[2]);
+        const auto permanent
+            = dlift * (aez * bcp + bez * acp + cez * abp)
+              + clift * (dez * abp + aez * bdp + bez * dap)
+              + blift * (cez * dap + dez * acp + aez * cdp)
+              + alift * (bez * cdp + cez * bdp + dez * bcp);
+        const auto bound = INSPHERE_ERROR_BOUND * permanent;
+        if (std::abs(det) > bound)
+            return det;
+        return insphere_exact(a, b, c, d, e) * std::max(std::abs(det), bound);
+    }
+}
@@ -8,6 +8,8 @@
 #include "Xyz/SimplexNoise.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <iterator>
 
 namespace Xyz
 {
@@ -81,18 +83,21 @@ namespace Xyz
                   permutation_ + 256);
     }
 
-    double SimplexNoise::simplex(double x, double y, double z)
+    double SimplexNoise::simplex(double x, double y, double z) const
     {
         // Calculate the "unit cube" that the point asked will be located in.
         // The left bound is ( |_x_|,|_y_|,|_z_| ) and the right bound is that
         // plus 1. Next we calculate the location (from 0.0 to 1.0) in that cube.
         // We also fade the location to smooth the result.
-        int xi = int(x) & 255;
-        int yi = int(y) & 255;
-        int zi = int(z) & 255;
-        double xf = x - int(x);
-        double yf = y - int(y);
-        double zf = z - int(z);
+        const auto x0 = std::floor(x);
+        const auto y0 = std::floor(y);
+        const auto z0 = std::floor(z);
+        int xi = int(x0) & 255;
+        int yi = int(y0) & 255;
+        int zi = int(z0) & 255;
+        double xf = x - x0;
+        double yf = y - y0;
+        double zf = z - z0;
         double u = fade(xf);
         double v = fade(yf);
         double w = fade(zf);
@@ -134,7 +139,7 @@ namespace Xyz
     }
 
     double SimplexNoise::simplex(double x, double y, double z,
-                                 int octaves, double persistence)
+                                 int octaves, double persistence) const
     {
         double total = 0;
         double frequency = 1;
@@ -0,0 +1,137 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Xyz/Mesh/AttributeEncoding.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <limits>
+#include <Xyz/Mesh/BuildMesh.hpp>
+
+TEST_CASE("AttributeEncoding: float to half")
+{
+    using Xyz::Details::float_to_half;
+    REQUIRE(float_to_half(0.0f) == 0x0000);
+    REQUIRE(float_to_half(-0.0f) == 0x8000);
+    REQUIRE(float_to_half(1.0f) == 0x3C00);
+    REQUIRE(float_to_half(-2.0f) == 0xC000);
+    REQUIRE(float_to_half(0.1f) == 0x2E66);
+    REQUIRE(float_to_half(65504.0f) == 0x7BFF);
+    REQUIRE(float_to_half(65519.0f) == 0x7BFF);
+    REQUIRE(float_to_half(65520.0f) == 0x7C00);
+    REQUIRE(float_to_half(std::numeric_limits<float>::infinity()) == 0x7C00);
+    REQUIRE((float_to_half(std::numeric_limits<float>::quiet_NaN()) & 0x7FFF) > 0x7C00);
+    // The smallest normal and subnormal halfs.
+    REQUIRE(float_to_half(std::ldexp(1.0f, -14)) == 0x0400);
+    REQUIRE(float_to_half(std::ldexp(1.0f, -24)) == 0x0001);
+    REQUIRE(float_to_half(std::ldexp(1.0f, -25)) == 0x0000);
+    REQUIRE(float_to_half(std::ldexp(1.5f, -25)) == 0x0001);
+    // Ties round to even.
+    REQUIRE(float_to_half(1.0f + std::ldexp(1.0f, -11)) == 0x3C00);
+    REQUIRE(float_to_half(1.0f + 3 * std::ldexp(1.0f, -11)) == 0x3C02);
+}
+
+TEST_CASE("AttributeEncoding: half to float")
+{
+    using Xyz::Details::half_to_float;
+    REQUIRE(half_to_float(0x3C00) == 1.0f);
+    REQUIRE(half_to_float(0xC000) == -2.0f);
+    REQUIRE(half_to_float(0x7BFF) == 65504.0f);
+    REQUIRE(half_to_float(0x0001) == std::ldexp(1.0f, -24));
+    REQUIRE(half_to_float(0x8000) == 0.0f);
+    REQUIRE(std::signbit(half_to_float(0x8000)));
+    REQUIRE(std::isinf(half_to_float(0xFC00)));
+    REQUIRE(std::isnan(half_to_float(0x7E00)));
+
+    // Every finite half survives a round trip.
+    for (uint32_t i = 0; i < 0x10000; ++i)
+    {
+        const auto h = uint16_t(i);
+        if ((h & 0x7C00) != 0x7C00)
+            REQUIRE(Xyz::Details::float_to_half(half_to_float(h)) == h);
+    }
+}
+
+TEST_CASE("AttributeEncoding: snorm16")
+{
+    using Encoding = Xyz::Snorm16Encoding<float, 3>;
+    const auto encoded = Encoding::encode({1, -1, 0.5f});
+    REQUIRE(encoded[0] == 32767);
+    REQUIRE(encoded[1] == -32767);
+    REQUIRE(encoded[2] == 16384);
+    REQUIRE(Encoding::encode({2, -2, 0})[1] == -32767);
+    REQUIRE(Encoding::decode({-32768, 0, 32767}) == Xyz::Vector3F(-1, 0, 1));
+}
+
+TEST_CASE("AttributeEncoding: octahedral normals")
+{
+    using Encoding = Xyz::OctahedralEncoding<double>;
+    REQUIRE(Encoding::decode(Encoding::encode({0, 0, 1})) == Xyz::Vector3D(0, 0, 1));
+    REQUIRE(Xyz::are_equal(Encoding::decode(Encoding::encode({0, 0, -1})),
+                           Xyz::Vector3D(0, 0, -1)));
+
+    // Points spread over the whole sphere.
+    for (int i = 0; i < 1000; ++i)
+    {
+        const auto z = 1 - (2 * i + 1) / 1000.0;
+        const auto r = std::sqrt(1 - z * z);
+        const auto angle = 2.39996322972865332 * i;
+        const Xyz::Vector3D n(r * std::cos(angle), r * std::sin(angle), z);
+        const auto decoded = Encoding::decode(Encoding::encode(n));
+        REQUIRE(std::abs(Xyz::get_length(decoded) - 1) < 1e-12);
+        REQUIRE(Xyz::get_length(decoded - n) < 1e-4);
+    }
+}
+
+TEST_CASE("AttributeEncoding: 10-10-10-2 tangents")
+{
+    using Encoding = Xyz::Snorm1010102Encoding<float>;
+    REQUIRE(Encoding::encode({0, 0, 1, -1}) == (511u << 20 | 3u << 30));
+    REQUIRE(Encoding::encode({-1, 1, 0, 1}) == (0x201u | 511u << 10 | 1u << 30));
+    REQUIRE(Encoding::decode(Encoding::encode({-1, 1, 0, 1}))
+            == Xyz::Vector4F(-1, 1, 0, 1));
+
+    const Xyz::Vector4F t(0.6f, -0.8f, 0, -1);
+    const auto decoded = Encoding::decode(Encoding::encode(t));
+    REQUIRE(Xyz::get_length(decoded - t) < 0.002f);
+    REQUIRE(decoded[3] == -1);
+}
+
+TEST_CASE("AttributeEncoding: MeshBuilder with packed attributes")
+{
+    using Buffer = std::vector<float>;
+    std::vector<uint32_t> indexes;
+    Buffer buffer;
+
+    // 24 bytes per vertex instead of 48.
+    Xyz::MeshBuilder builder{
+        .indexes = Xyz::MeshIndexBuilder<uint32_t>(indexes),
+        .coords = Xyz::MeshAttributeBuilder<Xyz::Vector3F, Buffer>(buffer, 6),
+        .normals = std::optional(Xyz::MeshAttributeBuilder<
+            Xyz::Vector3F, Buffer, Xyz::OctahedralEncoding<float>>(buffer, 6, 3)),
+        .tangents = std::optional(Xyz::MeshAttributeBuilder<
+            Xyz::Vector4F, Buffer, Xyz::Snorm1010102Encoding<float>>(buffer, 6, 4)),
+        .tex_coords = std::optional(Xyz::MeshAttributeBuilder<
+            Xyz::Vector2F, Buffer, Xyz::HalfEncoding<float, 2>>(buffer, 6, 5))
+    };
+
+    Xyz::OrientedCuboid<float> cuboid({{1, 2, 3}, {}}, {1, 2, 3});
+    Xyz::build_mesh(builder, cuboid);
+    Xyz::build_mesh(builder, Xyz::Pgram3F({0, 0, 0}, {2, 0, 0}, {0, 2, 0}),
+                    {{0, 0}, {0.5f, 0.25f}}, 24);
+    REQUIRE(buffer.size() == 28 * 6);
+    REQUIRE(indexes.size() == 42);
+
+    for (size_t i = 0; i < 28; ++i)
+    {
+        REQUIRE(std::abs(Xyz::get_length(builder.normals->get(i)) - 1) < 1e-6f);
+        REQUIRE(std::abs(builder.tangents->get(i)[3]) == 1);
+    }
+    REQUIRE(Xyz::are_equal(builder.normals->get(24), Xyz::Vector3F(0, 0, 1)));
+    REQUIRE(builder.tangents->get(24) == Xyz::Vector4F(1, 0, 0, 1));
+    REQUIRE(builder.tex_coords->get(26) == Xyz::Vector2F(0.5f, 0.25f));
+}
@@ -9,6 +9,8 @@
 #include <Xyz/TransformationMatrix.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <vector>
+
 namespace
 {
     using BBox2I = Xyz::BBox<int, 2>;
@@ -239,3 +241,124 @@ TEST_CASE("BBox: operators work in 3 dimensions")
     REQUIRE(static_cast<bool>(b));
     REQUIRE(!static_cast<bool>(BBox3I()));
 }
+
+TEST_CASE("BBox: transform_bbox_no_w matches the corners for rotations (3D double)")
+{
+    // An arbitrary rotation followed by a translation, where every element
+    // of the linear part is non-zero.
+    const auto m = Xyz::affine::translate3(1.0, -2.0, 3.0)
+                   * Xyz::affine::rotate_z(0.3)
+                   * Xyz::affine::rotate_y(-1.1)
+                   * Xyz::affine::rotate_x(2.0);
+    const Xyz::BBox3D box(Xyz::Vector3D(-1, 2, 0.5), Xyz::Vector3D(3, 2.5, 4));
+
+    Xyz::BBox3D expected;
+    for (unsigned i = 0; i < 8; ++i)
+    {
+        const Xyz::Vector3D corner(i & 1 ? box.max[0] : box.min[0],
+                                   i & 2 ? box.max[1] : box.min[1],
+                                   i & 4 ? box.max[2] : box.min[2]);
+        expected += transform_vector(m, corner);
+    }
+
+    const auto result = transform_bbox_no_w(box, m);
+    REQUIRE(are_equal(result.min, expected.min, 1e-12));
+    REQUIRE(are_equal(result.max, expected.max, 1e-12));
+}
+
+TEST_CASE("BBox: transform_bbox with a projective matrix transforms the corners")
+{
+    // The w component depends on x, so the matrix isn't affine.
+    constexpr Xyz::Matrix3D m = {
+        1, 0, 0,
+        0, 1, 0,
+        1, 0, 1
+    };
+    const Xyz::BBox2D box(Xyz::Vector2D(1, 1), Xyz::Vector2D(3, 2));
+    const auto result = transform_bbox(box, m);
+    REQUIRE(are_equal(result.min, Xyz::Vector2D(0.5, 0.25)));
+    REQUIRE(are_equal(result.max, Xyz::Vector2D(0.75, 1)));
+}
+
+TEST_CASE("BBox: transform_bboxes_no_w transforms every box")
+{
+    const auto m = Xyz::affine::translate3(1.f, 2.f, 3.f)
+                   * Xyz::affine::rotate_z(0.5f);
+    const std::vector<Xyz::BBox3F> boxes = {
+        {V3F(0, 0, 0), V3F(1, 1, 1)},
+        {},
+        {V3F(-4, 2, 1), V3F(-1, 5, 7)}
+    };
+
+    std::vector<Xyz::BBox3F> result(boxes.size());
+    transform_bboxes_no_w(boxes, m, result);
+    for (size_t i = 0; i < boxes.size(); ++i)
+    {
+        CAPTURE(i);
+        const auto expected = transform_bbox(boxes[i], m);
+        REQUIRE(static_cast<bool>(result[i]) == static_cast<bool>(expected));
+        if (expected)
+        {
+            REQUIRE(are_equal(result[i].min, expected.min));
+            REQUIRE(are_equal(result[i].max, expected.max));
+        }
+    }
+
+    std::vector<Xyz::BBox3F> too_small(2);
+    REQUIRE_THROWS(transform_bboxes_no_w(boxes, m, too_small));
+}
+
+TEST_CASE("BBox: transform_bboxes handles projective matrices")
+{
+    constexpr Xyz::Matrix3D m = {
+        1, 0, 0,
+        0, 1, 0,
+        1, 0, 1
+    };
+    std::vector<Xyz::BBox2D> boxes = {
+        {Xyz::Vector2D(1, 1), Xyz::Vector2D(3, 2)},
+        {Xyz::Vector2D(0, 0), Xyz::Vector2D(1, 1)}
+    };
+    // Transform in place.
+    transform_bboxes(boxes, m, boxes);
+    REQUIRE(are_equal(boxes[0].min, Xyz::Vector2D(0.5, 0.25)));
+    REQUIRE(are_equal(boxes[0].max, Xyz::Vector2D(0.75, 1)));
+    REQUIRE(are_equal(boxes[1].min, Xyz::Vector2D(0, 0)));
+    REQUIRE(are_equal(boxes[1].max, Xyz::Vector2D(0.5, 1)));
+}
+
+TEST_CASE("BBox: compute_bbox")
+{
+    std::vector<V3F> points;
+    // An odd number of points, so the last block is incomplete.
+    for (int i = 0; i < 1003; ++i)
+        points.emplace_back(float(i % 17), float(-i % 5), float(i) / 10);
+
+    const auto box = Xyz::compute_bbox(std::span<const V3F>(points));
+    REQUIRE(box.min == V3F(0, -4, 0));
+    REQUIRE(box.max == V3F(16, 0, 100.2f));
+
+    SECTION("empty span gives an invalid box")
+    {
+        REQUIRE(!Xyz::compute_bbox(std::span<const V3F>()));
+    }
+
+    SECTION("single point")
+    {
+        const auto single = Xyz::compute_bbox(std::span<const V3F>(points.data(), 1));
+        REQUIRE(single.min == V3F(0, 0, 0));
+        REQUIRE(single.max == V3F(0, 0, 0));
+    }
+}
+
+TEST_CASE("BBox: compute_bbox with several threads")
+{
+    std::vector<V2> points;
+    for (int i = 0; i < 300000; ++i)
+        points.emplace_back(i % 1000 - 500, (i * 37) % 100003);
+    points[123456] = V2(-2000, 200000);
+
+    const auto box = Xyz::compute_bbox(std::span<const V2>(points), 4);
+    REQUIRE(box.min == V2(-2000, 0));
+    REQUIRE(box.max == V2(499, 200000));
+}
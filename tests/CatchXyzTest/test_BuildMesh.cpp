@@ -10,6 +10,8 @@
 
 #include <Xyz/Mesh/MeshAttributeBuilder.hpp>
 
+#include <array>
+
 #include "Xyz/OrientedCuboid.hpp"
 #include "Xyz/OrientedRectangle.hpp"
 #include "Xyz/Mesh/BuildMesh.hpp"
@@ -192,3 +194,198 @@ TEST_CASE("BuildMesh: tangent handedness follows the texture rectangle")
         REQUIRE(builder.tangents->get(i) == expected);
     }
 }
+
+TEST_CASE("BuildMesh: predict_mesh_size")
+{
+    const Xyz::OrientedCuboid<float> cuboid{{{0, 0, 0}, {}}, {1, 1, 1}};
+    const Xyz::OrientedRectangle3F rect({{0, 0, 0}, {}}, {1, 1});
+    CHECK(Xyz::predict_mesh_size(cuboid) == Xyz::MeshSize{24, 36});
+    CHECK(Xyz::predict_mesh_size(rect) == Xyz::MeshSize{4, 6});
+    CHECK(Xyz::predict_mesh_size(Xyz::Pgram<float, 3>())
+          == Xyz::MeshSize{4, 6});
+    CHECK(2 * Xyz::predict_mesh_size(cuboid) + Xyz::predict_mesh_size(rect)
+          == Xyz::MeshSize{52, 78});
+}
+
+TEST_CASE("BuildMesh: reserve interleaved buffer for many shapes")
+{
+    std::vector<uint32_t> indexes;
+    std::vector<float> buffer;
+
+    using Builder2F = Xyz::MeshAttributeBuilder<Xyz::Vector2F, std::vector<float>>;
+    using Builder3F = Xyz::MeshAttributeBuilder<Xyz::Vector3F, std::vector<float>>;
+
+    Xyz::MeshBuilder builder{
+        .indexes = Xyz::MeshIndexBuilder<uint32_t>(indexes),
+        .coords = Builder3F(buffer, 8),
+        .normals = std::optional(Builder3F(buffer, 8, 3)),
+        .tex_coords = std::optional(Builder2F(buffer, 8, 6))
+    };
+
+    std::vector<Xyz::OrientedCuboid<float>> cuboids;
+    Xyz::MeshSize size;
+    for (int i = 0; i < 100; ++i)
+    {
+        cuboids.push_back({{{float(i), 0, 0}, {}}, {1, 1, 1}});
+        size += Xyz::predict_mesh_size(cuboids.back());
+    }
+
+    builder.reserve(size);
+    REQUIRE(buffer.size() == size.vertexes * 8);
+    REQUIRE(indexes.capacity() >= size.indexes);
+    const auto* buffer_data = buffer.data();
+    const auto* index_data = indexes.data();
+
+    for (size_t i = 0; i < cuboids.size(); ++i)
+        Xyz::build_mesh(builder, cuboids[i], {}, uint32_t(i * 24));
+
+    CHECK(buffer.data() == buffer_data);
+    CHECK(indexes.data() == index_data);
+    CHECK(builder.coords.size() == size.vertexes);
+    CHECK(builder.normals->size() == size.vertexes);
+    CHECK(builder.tex_coords->size() == size.vertexes);
+    CHECK(indexes.size() == size.indexes);
+    CHECK(buffer.size() == size.vertexes * 8);
+}
+
+TEST_CASE("BuildMesh: build_meshes matches build_mesh")
+{
+    using Builder2F = Xyz::MeshAttributeBuilder<Xyz::Vector2F, std::vector<float>>;
+    using Builder3F = Xyz::MeshAttributeBuilder<Xyz::Vector3F, std::vector<float>>;
+    using Builder4F = Xyz::MeshAttributeBuilder<Xyz::Vector4F, std::vector<float>>;
+
+    struct Mesh
+    {
+        std::vector<uint32_t> indexes;
+        std::vector<float> buffer;
+        Xyz::MeshBuilder<std::vector<float>, float, uint32_t> builder{
+            .indexes = Xyz::MeshIndexBuilder<uint32_t>(indexes),
+            .coords = Builder3F(buffer, 12),
+            .normals = std::optional(Builder3F(buffer, 12, 3)),
+            .tangents = std::optional(Builder4F(buffer, 12, 6)),
+            .tex_coords = std::optional(Builder2F(buffer, 12, 10))
+        };
+    };
+
+    std::vector<Xyz::OrientedCuboid<float>> cuboids;
+    for (int i = 0; i < 5000; ++i)
+        cuboids.push_back({{{float(i % 17), float(i / 17), 0}, {}}, {1, 2, 3}});
+
+    auto tex_rect_func = [](int face)
+    {
+        return Xyz::Rectangle<float>({float(face), 0}, {1, 1});
+    };
+
+    // Something already in the buffers.
+    const Xyz::OrientedRectangle3F rect({{0, 0, 0}, {}}, {1, 1});
+    const std::function<Xyz::Rectangle<float>(int)> func = tex_rect_func;
+
+    Mesh expected;
+    Xyz::build_mesh(expected.builder, rect);
+    for (size_t i = 0; i < cuboids.size(); ++i)
+        Xyz::build_mesh(expected.builder, cuboids[i], func, uint32_t(4 + 24 * i));
+
+    for (unsigned threads : {1u, 3u})
+    {
+        CAPTURE(threads);
+        Mesh mesh;
+        Xyz::build_mesh(mesh.builder, rect);
+        Xyz::build_meshes(mesh.builder,
+                          std::span<const Xyz::OrientedCuboid<float>>(cuboids),
+                          func, threads);
+        CHECK(mesh.builder.coords.size() == expected.builder.coords.size());
+        CHECK(mesh.builder.tex_coords->size() == expected.builder.coords.size());
+        CHECK(mesh.indexes == expected.indexes);
+        CHECK(mesh.buffer == expected.buffer);
+    }
+
+    // Without texture argument.
+    Mesh plain;
+    Xyz::build_meshes(plain.builder,
+                      std::span<const Xyz::OrientedCuboid<float>>(cuboids), 2);
+    CHECK(plain.indexes.size() == 36 * cuboids.size());
+    CHECK(plain.indexes.back() == 24 * cuboids.size() - 2);
+}
+
+namespace
+{
+    // A shape whose predicted size is smaller than what build_mesh adds.
+    struct UnderpredictedShape
+    {
+        Xyz::Vector3F origin;
+    };
+
+    Xyz::MeshSize predict_mesh_size(const UnderpredictedShape&)
+    {
+        return {3, 3};
+    }
+
+    template <typename Builder>
+    void build_mesh(Builder& builder,
+                    const UnderpredictedShape& shape,
+                    const Xyz::Rectangle<float>&,
+                    typename Builder::IndexType base_index)
+    {
+        for (int i = 0; i < 4; ++i)
+            builder.coords.add(shape.origin);
+        builder.indexes.add(base_index, base_index + 1, base_index + 2);
+    }
+}
+
+TEST_CASE("BuildMesh: build_meshes with wrong size prediction")
+{
+    using Builder3F = Xyz::MeshAttributeBuilder<Xyz::Vector3F, std::vector<float>>;
+
+    std::vector<UnderpredictedShape> shapes(5000);
+    for (unsigned threads : {1u, 3u})
+    {
+        CAPTURE(threads);
+        std::vector<uint32_t> indexes;
+        std::vector<float> buffer;
+        Xyz::MeshBuilder<std::vector<float>, float, uint32_t> builder{
+            .indexes = Xyz::MeshIndexBuilder<uint32_t>(indexes),
+            .coords = Builder3F(buffer, 3)
+        };
+        REQUIRE_THROWS_AS(
+            Xyz::build_meshes(builder,
+                              std::span<const UnderpredictedShape>(shapes),
+                              Xyz::Rectangle<float>(), threads),
+            std::logic_error);
+        CHECK(buffer.size() == 3 * 3 * shapes.size());
+    }
+}
+
+TEST_CASE("BuildMesh: OrientedCuboid with a lambda for the texture rectangles")
+{
+    using Builder2F = Xyz::MeshAttributeBuilder<Xyz::Vector2F, std::vector<float>>;
+    using Builder3F = Xyz::MeshAttributeBuilder<Xyz::Vector3F, std::vector<float>>;
+
+    const std::array<Xyz::Rectangle<float>, 6> tex_rects = {{
+        {{0, 0}, {1, 1}}, {{1, 0}, {1, 1}}, {{2, 0}, {1, 1}},
+        {{3, 0}, {1, 1}}, {{4, 0}, {1, 1}}, {{5, 0}, {1, -1}}
+    }};
+    const auto tex_rect_func = [&](int face) {return tex_rects[size_t(face)];};
+    const Xyz::OrientedCuboid<float> cuboid{{{1, 2, 3}, {0.5f, 0, 0}}, {2, 3, 4}};
+
+    std::vector<uint32_t> indexes1, indexes2;
+    std::vector<float> buffer1, buffer2;
+    Xyz::MeshBuilder builder1{
+        .indexes = Xyz::MeshIndexBuilder<uint32_t>(indexes1),
+        .coords = Builder3F(buffer1, 5),
+        .tex_coords = std::optional(Builder2F(buffer1, 5, 3))
+    };
+    Xyz::MeshBuilder builder2{
+        .indexes = Xyz::MeshIndexBuilder<uint32_t>(indexes2),
+        .coords = Builder3F(buffer2, 5),
+        .tex_coords = std::optional(Builder2F(buffer2, 5, 3))
+    };
+
+    Xyz::build_mesh(builder1, cuboid,
+                    std::function<Xyz::Rectangle<float>(int)>(tex_rect_func), 7);
+    Xyz::build_mesh(builder2, cuboid, tex_rect_func, 7);
+
+    CHECK(indexes1 == indexes2);
+    CHECK(buffer1 == buffer2);
+    CHECK(builder2.tex_coords->get(20) == Xyz::Vector2F(5, 0));
+    CHECK(builder2.tex_coords->get(22) == Xyz::Vector2F(6, -1));
+}
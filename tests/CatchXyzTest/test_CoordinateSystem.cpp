@@ -6,6 +6,7 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #include <Xyz/CoordinateSystem.hpp>
+#include <vector>
 #include <catch2/catch_test_macros.hpp>
 
 namespace
@@ -63,4 +64,58 @@ namespace
         REQUIRE(are_equal(cs->y_axis(), V(1 / sqrt(6), 1 / sqrt(6), sqrt(2. / 3))));
         REQUIRE(are_equal(cs->z_axis(), V(-1 / sqrt(3), -1 / sqrt(3), 1 / sqrt(3))));
     }
+
+    TEST_CASE("CoordinateSystem: batched conversions", "[CoordinateSystem]")
+    {
+        const Xyz::CoordinateSystem<double> cs({1, 2, 3}, {1, 1, 0},
+                                               {-1, 1, 1}, {1, -1, 2});
+        std::vector<Xyz::Vector3D> points;
+        std::vector<Xyz::Vector2D> points_2d;
+        for (int i = 0; i < 20; ++i)
+        {
+            points.push_back({0.5 * i, 3.0 - i, 0.25 * i * i});
+            points_2d.push_back({i - 10.0, 0.5 * i});
+        }
+
+        std::vector<Xyz::Vector3D> result(points.size());
+        cs.to_cs(points, result);
+        for (size_t i = 0; i < points.size(); ++i)
+            CHECK(are_equal(result[i], cs.to_cs(points[i]), 1e-12));
+
+        cs.from_cs(points, result);
+        for (size_t i = 0; i < points.size(); ++i)
+            CHECK(are_equal(result[i], cs.from_cs(points[i]), 1e-12));
+
+        std::vector<Xyz::Vector2D> result_2d(points.size());
+        cs.to_cs_xy(points, result_2d);
+        for (size_t i = 0; i < points.size(); ++i)
+            CHECK(are_equal(result_2d[i], cs.to_cs_xy(points[i]), 1e-12));
+
+        cs.from_cs_xy(points_2d, result);
+        for (size_t i = 0; i < points_2d.size(); ++i)
+            CHECK(are_equal(result[i], cs.from_cs_xy(points_2d[i]), 1e-12));
+
+        // In place.
+        auto copy = points;
+        cs.to_cs(copy, copy);
+        cs.from_cs(copy, copy);
+        for (size_t i = 0; i < points.size(); ++i)
+            CHECK(are_equal(copy[i], points[i], 1e-12));
+
+        CHECK_THROWS(cs.to_cs(points, std::span(result).first(3)));
+    }
+
+    TEST_CASE("CoordinateSystem: batched conversions, projective matrix", "[CoordinateSystem]")
+    {
+        const Xyz::CoordinateSystem<double> cs(Xyz::Matrix4D(
+            1, 0, 0, 0,
+            0, 1, 0, 0,
+            0, 0, 1, 0,
+            0, 0, 0.5, 1));
+        const std::vector<Xyz::Vector3D> points{{1, 2, 2}, {-1, 0, 4}};
+        std::vector<Xyz::Vector3D> result(points.size());
+        cs.from_cs(points, result);
+        CHECK(are_equal(result[0], Xyz::Vector3D(0.5, 1, 1)));
+        CHECK(are_equal(result[1], cs.from_cs(points[1])));
+    }
 }
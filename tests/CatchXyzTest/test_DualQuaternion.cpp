@@ -0,0 +1,146 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Xyz/DualQuaternion.hpp>
+
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+#include <Xyz/TransformationMatrix.hpp>
+#include <Xyz/Utilities.hpp>
+
+using Xyz::to_radians;
+
+namespace
+{
+    constexpr double MARGIN = 1e-12;
+
+    const Xyz::Vector3D AXIS(1, 2, 3);
+
+    Xyz::Vector3D transform(const Xyz::Matrix4D& m, const Xyz::Vector3D& p)
+    {
+        const auto v = m * make_vector4(p, 1.0);
+        return {v[0], v[1], v[2]};
+    }
+}
+
+TEST_CASE("DualQuaternion: default is the identity")
+{
+    constexpr Xyz::DualQuaternionD dq;
+    CHECK(transform_point(dq, Xyz::Vector3D(1, 2, 3)) == Xyz::Vector3D(1, 2, 3));
+    CHECK(Xyz::affine::to_matrix(dq) == Xyz::make_identity_matrix<double, 4>());
+}
+
+TEST_CASE("DualQuaternion: rotation and translation")
+{
+    const auto q = make_quaternion(to_radians(70.0), AXIS);
+    const Xyz::Vector3D offset(4, -5, 6);
+    const auto dq = make_dual_quaternion(q, offset);
+    CHECK(are_equal(get_translation(dq), offset, MARGIN));
+
+    const Xyz::Vector3D p(-1, 2, 0.5);
+    CHECK(are_equal(transform_point(dq, p), rotate(q, p) + offset, MARGIN));
+    CHECK(are_equal(transform_vector(dq, p), rotate(q, p), MARGIN));
+    CHECK(are_equal(transform_point(dq, p),
+                    transform(Xyz::affine::to_matrix(q, offset), p), MARGIN));
+}
+
+TEST_CASE("DualQuaternion: matrix round-trip")
+{
+    const auto m = Xyz::affine::to_matrix(make_quaternion(to_radians(-150.0), AXIS),
+                                          Xyz::Vector3D(1, 2, 3));
+    const auto dq = to_dual_quaternion(m);
+    CHECK(are_equal(Xyz::affine::to_matrix(dq), m, MARGIN));
+}
+
+TEST_CASE("DualQuaternion: the product applies the right hand side first")
+{
+    const auto a = make_dual_quaternion(make_quaternion(to_radians(30.0), AXIS),
+                                        Xyz::Vector3D(1, 0, 0));
+    const auto b = make_dual_quaternion(make_quaternion(to_radians(-80.0),
+                                                        Xyz::Vector3D(0, 0, 1)),
+                                        Xyz::Vector3D(0, 2, -1));
+    const Xyz::Vector3D p(3, 1, 2);
+    CHECK(are_equal(transform_point(a * b, p),
+                    transform_point(a, transform_point(b, p)), MARGIN));
+    CHECK(are_equal(Xyz::affine::to_matrix(a * b),
+                    Xyz::affine::to_matrix(a) * Xyz::affine::to_matrix(b), MARGIN));
+}
+
+TEST_CASE("DualQuaternion: conjugate is the inverse")
+{
+    const auto dq = make_dual_quaternion(make_quaternion(to_radians(45.0), AXIS),
+                                         Xyz::Vector3D(7, 8, 9));
+    CHECK(are_equal(dq * conjugate(dq), Xyz::DualQuaternionD(), MARGIN));
+    const Xyz::Vector3D p(1, -1, 2);
+    CHECK(are_equal(transform_point(conjugate(dq), transform_point(dq, p)), p,
+                    MARGIN));
+}
+
+TEST_CASE("DualQuaternion: normalize")
+{
+    const auto dq = make_dual_quaternion(make_quaternion(to_radians(45.0), AXIS),
+                                         Xyz::Vector3D(7, 8, 9));
+    CHECK(are_equal(normalize(dq * 3.0), dq, MARGIN));
+    // A dual part with a component along the real part.
+    const Xyz::DualQuaternionD skewed(dq.real, dq.dual + dq.real * 0.5);
+    CHECK(are_equal(normalize(skewed), dq, MARGIN));
+    CHECK_THROWS(normalize(Xyz::DualQuaternionD({0, 0, 0, 0}, {1, 0, 0, 0})));
+}
+
+TEST_CASE("DualQuaternion: blend joints")
+{
+    const std::vector<Xyz::DualQuaternionD> joints{
+        make_dual_quaternion(Xyz::QuaternionD(), Xyz::Vector3D(0, 0, 0)),
+        make_dual_quaternion(make_quaternion(to_radians(90.0), Xyz::Vector3D(0, 0, 1)),
+                             Xyz::Vector3D(0, 0, 2)),
+        // The same transformation as joints[1], but negated.
+        -make_dual_quaternion(make_quaternion(to_radians(90.0), Xyz::Vector3D(0, 0, 1)),
+                              Xyz::Vector3D(0, 0, 2))
+    };
+    const std::vector<uint32_t> indexes{0, 1, 1, 0, 0, 2};
+    const std::vector<double> weights{1, 0, 0.5, 0.5, 0.5, 0.5};
+    std::vector<Xyz::DualQuaternionD> result(3);
+    Xyz::blend_dual_quaternions(joints, indexes, weights, 2, std::span(result));
+
+    CHECK(are_equivalent(result[0], joints[0], MARGIN));
+    const auto halfway = make_dual_quaternion(
+        make_quaternion(to_radians(45.0), Xyz::Vector3D(0, 0, 1)),
+        Xyz::Vector3D(0, 0, 1));
+    CHECK(are_equivalent(result[1], halfway, MARGIN));
+    // The antipodal joint is blended along the short path too.
+    CHECK(are_equivalent(result[2], halfway, MARGIN));
+
+    // Blending preserves lengths, unlike blending matrices.
+    const std::vector<Xyz::Vector3D> points{{1, 0, 0}, {1, 0, 0}, {1, 0, 0}};
+    std::vector<Xyz::Vector3D> skinned(3);
+    Xyz::skin_points(joints, indexes, weights, 2, points, std::span(skinned));
+    for (size_t i = 0; i < points.size(); ++i)
+        CHECK(are_equal(skinned[i], transform_point(result[i], points[i]), MARGIN));
+    CHECK(are_equal(skinned[1], Xyz::Vector3D(std::sqrt(0.5), std::sqrt(0.5), 1),
+                    MARGIN));
+}
+
+TEST_CASE("DualQuaternion: blend with 16-bit indexes and invalid input")
+{
+    const std::vector<Xyz::DualQuaternionF> joints(2);
+    const std::vector<uint16_t> indexes{0, 1};
+    const std::vector<float> weights{0.25f, 0.75f};
+    std::vector<Xyz::DualQuaternionF> result(1);
+    Xyz::blend_dual_quaternions<float, uint16_t>(joints, indexes, weights, 2,
+                                                 result);
+    CHECK(result[0] == Xyz::DualQuaternionF());
+
+    const std::vector<uint32_t> bad_indexes{0, 2};
+    CHECK_THROWS(Xyz::blend_dual_quaternions(joints, bad_indexes, weights, 2,
+                                             std::span(result)));
+    CHECK_THROWS(Xyz::blend_dual_quaternions(joints, std::vector<uint32_t>{0},
+                                             weights, 2, std::span(result)));
+    const std::vector<float> zero_weights{0, 0};
+    CHECK_THROWS(Xyz::blend_dual_quaternions(joints, std::vector<uint32_t>{0, 1},
+                                             zero_weights, 2, std::span(result)));
+}
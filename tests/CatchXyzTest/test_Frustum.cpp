@@ -0,0 +1,124 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Xyz/Frustum.hpp>
+#include <Xyz/ProjectionMatrix.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <vector>
+
+namespace
+{
+    using V3 = Xyz::Vector3D;
+
+    // A camera at (0, 0, 10) looking towards the origin, with a 90 degree
+    // field of view and near and far planes at distances 1 and 100.
+    Xyz::FrustumD make_test_frustum()
+    {
+        const auto view = Xyz::make_look_at_matrix<double>({0, 0, 10},
+                                                           {0, 0, 0},
+                                                           {0, 1, 0});
+        const auto projection = Xyz::make_frustum_matrix<double>(
+            -1, 1, -1, 1, 1, 100);
+        return Xyz::make_frustum(projection * view);
+    }
+}
+
+TEST_CASE("Frustum: extract planes from a projection matrix")
+{
+    using Catch::Matchers::WithinAbs;
+    const auto frustum = make_test_frustum();
+
+    for (const auto& plane : frustum.planes)
+        CHECK_THAT(get_length(plane.normal), WithinAbs(1.0, 1e-12));
+
+    // The near and far planes are perpendicular to the view direction.
+    const auto& near = frustum.planes[4];
+    CHECK(are_equal(near.normal, V3(0, 0, -1), 1e-12));
+    CHECK_THAT(get_signed_distance(near, V3(0, 0, 9)), WithinAbs(0, 1e-9));
+    const auto& far = frustum.planes[5];
+    CHECK(are_equal(far.normal, V3(0, 0, 1), 1e-12));
+    CHECK_THAT(get_signed_distance(far, V3(0, 0, -90)), WithinAbs(0, 1e-9));
+
+    // The left plane goes through the eye at 45 degrees.
+    const auto& left = frustum.planes[0];
+    CHECK_THAT(get_signed_distance(left, V3(0, 0, 10)), WithinAbs(0, 1e-9));
+    CHECK_THAT(get_signed_distance(left, V3(-5, 0, 5)), WithinAbs(0, 1e-9));
+    CHECK(get_signed_distance(left, V3(0, 0, 5)) > 0);
+}
+
+TEST_CASE("Frustum: contains point")
+{
+    const auto frustum = make_test_frustum();
+    CHECK(contains_point(frustum, V3(0, 0, 0)));
+    CHECK(contains_point(frustum, V3(4.9, -4.9, 5)));
+    CHECK_FALSE(contains_point(frustum, V3(5.1, 0, 5)));
+    CHECK_FALSE(contains_point(frustum, V3(0, 0, 9.5)));
+    CHECK_FALSE(contains_point(frustum, V3(0, 0, -95)));
+}
+
+TEST_CASE("Frustum: intersects sphere")
+{
+    const auto frustum = make_test_frustum();
+    CHECK(intersects(frustum, V3(0, 0, 0), 1));
+    CHECK(intersects(frustum, V3(20, 0, 0), 7.2));
+    CHECK_FALSE(intersects(frustum, V3(20, 0, 0), 7));
+    CHECK(intersects(frustum, V3(0, 0, 12), 3.5));
+    CHECK_FALSE(intersects(frustum, V3(0, 0, 12), 2.5));
+}
+
+TEST_CASE("Frustum: intersects BBox")
+{
+    using B = Xyz::BBox3D;
+    const auto frustum = make_test_frustum();
+    CHECK(intersects(frustum, B({-1, -1, -1}, {1, 1, 1})));
+    // Larger than the frustum in every direction.
+    CHECK(intersects(frustum, B({-500, -500, -500}, {500, 500, 500})));
+    CHECK(intersects(frustum, B({4, -1, 4}, {8, 1, 6})));
+    CHECK_FALSE(intersects(frustum, B({6, -1, 4}, {8, 1, 6})));
+    CHECK_FALSE(intersects(frustum, B({-1, -1, 9.5}, {1, 1, 20})));
+    CHECK_FALSE(intersects(frustum, B()));
+}
+
+TEST_CASE("Frustum: cull boxes")
+{
+    const auto frustum = make_test_frustum();
+
+    // A row of boxes along the x-axis at z = 5, where the frustum spans
+    // from x = -5 to x = 5.
+    std::vector<double> xs, ys, zs, exs, eys, ezs;
+    for (int i = 0; i < 100; ++i)
+    {
+        xs.push_back(-50 + i);
+        ys.push_back(0);
+        zs.push_back(5);
+        exs.push_back(0.25);
+        eys.push_back(0.25);
+        ezs.push_back(0.25);
+    }
+
+    const Xyz::BBoxArrays<double> boxes{{xs, ys, zs}, {exs, eys, ezs}};
+    std::vector<uint64_t> visibility(2, ~uint64_t(0));
+    cull_bboxes(frustum, boxes, visibility);
+
+    for (size_t i = 0; i < xs.size(); ++i)
+    {
+        CAPTURE(i);
+        const Xyz::BBox3D box({xs[i] - 0.25, -0.25, 4.75},
+                              {xs[i] + 0.25, 0.25, 5.25});
+        const bool visible = (visibility[i / 64] >> (i % 64)) & 1;
+        CHECK(visible == intersects(frustum, box));
+        CHECK(visible == (std::abs(xs[i]) <= 5));
+    }
+
+    // The unused bits in the last element are cleared.
+    CHECK(visibility[1] >> (100 - 64) == 0);
+
+    std::vector<uint64_t> too_small;
+    CHECK_THROWS(cull_bboxes(frustum, boxes, too_small));
+}
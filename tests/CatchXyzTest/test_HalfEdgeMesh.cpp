@@ -0,0 +1,141 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Xyz/Mesh/HalfEdgeMesh.hpp>
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+
+#include <Xyz/Mesh/Primitives.hpp>
+
+namespace
+{
+    template <typename Range>
+    auto to_vector(const Range& range)
+    {
+        std::vector<std::decay_t<decltype(*range.begin())>> result;
+        for (auto value : range)
+            result.push_back(value);
+        return result;
+    }
+
+    template <typename Range>
+    auto to_sorted_vector(const Range& range)
+    {
+        auto result = to_vector(range);
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+}
+
+TEST_CASE("HalfEdgeMesh: two triangles")
+{
+    // 3---2
+    // | / |
+    // 0---1
+    const std::vector<uint16_t> indexes{0, 2, 3, 0, 1, 2};
+    const Xyz::HalfEdgeMesh mesh(indexes, 4);
+    REQUIRE(mesh.face_count() == 2);
+    REQUIRE(mesh.half_edge_count() == 6);
+    REQUIRE(mesh.vertex_count() == 4);
+
+    REQUIRE(mesh.origin(0) == 0);
+    REQUIRE(mesh.destination(0) == 2);
+    REQUIRE(mesh.twin(0) == 5);
+    REQUIRE(mesh.twin(5) == 0);
+    REQUIRE(mesh.is_boundary(1));
+    REQUIRE(mesh.face_neighbors(0)
+            == std::array<Xyz::FaceId, 3>{1, Xyz::INVALID_FACE_ID, Xyz::INVALID_FACE_ID});
+    REQUIRE(mesh.face_neighbors(1)
+            == std::array<Xyz::FaceId, 3>{Xyz::INVALID_FACE_ID, Xyz::INVALID_FACE_ID, 0});
+
+    REQUIRE(mesh.is_boundary_vertex(0));
+    REQUIRE(to_vector(mesh.vertex_neighbors(0)) == std::vector<Xyz::VertexId>{1, 2, 3});
+    REQUIRE(to_vector(mesh.vertex_neighbors(1)) == std::vector<Xyz::VertexId>{2, 0});
+    REQUIRE(to_vector(mesh.vertex_neighbors(2)) == std::vector<Xyz::VertexId>{3, 0, 1});
+    REQUIRE(to_vector(mesh.outgoing_half_edges(0)) == std::vector<Xyz::HalfEdgeId>{3, 0});
+
+    // The boundary goes counterclockwise around the quad.
+    std::vector<Xyz::VertexId> loop;
+    for (auto h : mesh.boundary_loop(mesh.vertex_half_edge(0)))
+        loop.push_back(mesh.origin(h));
+    REQUIRE(loop == std::vector<Xyz::VertexId>{0, 1, 2, 3});
+}
+
+TEST_CASE("HalfEdgeMesh: closed octahedron")
+{
+    // +x, -x, +y, -y, +z, -z
+    const std::vector<uint32_t> indexes{
+        0, 2, 4,  2, 1, 4,  1, 3, 4,  3, 0, 4,
+        2, 0, 5,  1, 2, 5,  3, 1, 5,  0, 3, 5
+    };
+    const Xyz::HalfEdgeMesh mesh(indexes, 6);
+
+    for (Xyz::HalfEdgeId h = 0; h < mesh.half_edge_count(); ++h)
+    {
+        REQUIRE(!mesh.is_boundary(h));
+        REQUIRE(mesh.twin(mesh.twin(h)) == h);
+        REQUIRE(mesh.origin(mesh.twin(h)) == mesh.destination(h));
+    }
+
+    REQUIRE(to_sorted_vector(mesh.vertex_neighbors(4))
+            == std::vector<Xyz::VertexId>{0, 1, 2, 3});
+    REQUIRE(to_sorted_vector(mesh.vertex_neighbors(0))
+            == std::vector<Xyz::VertexId>{2, 3, 4, 5});
+    REQUIRE(to_vector(mesh.outgoing_half_edges(5)).size() == 4);
+    REQUIRE(!mesh.is_boundary_vertex(0));
+}
+
+TEST_CASE("HalfEdgeMesh: grid built with MeshBuilder")
+{
+    std::vector<uint32_t> indexes;
+    std::vector<float> coords;
+    Xyz::MeshBuilder builder{
+        .indexes = Xyz::MeshIndexBuilder<uint32_t>(indexes),
+        .coords = Xyz::MeshAttributeBuilder<Xyz::Vector3F, std::vector<float>>(coords, 3)
+    };
+    Xyz::build_mesh(builder, Xyz::GridPlane<float>{{{}, {3, 2}}, 3, 2});
+    const Xyz::HalfEdgeMesh mesh(indexes, builder.coords.size());
+
+    size_t boundary_edges = 0;
+    for (Xyz::HalfEdgeId h = 0; h < mesh.half_edge_count(); ++h)
+        boundary_edges += mesh.is_boundary(h) ? 1 : 0;
+    REQUIRE(boundary_edges == 10);
+    REQUIRE(to_vector(mesh.boundary_loop(mesh.vertex_half_edge(0))).size() == 10);
+
+    // Vertex 5 is the interior vertex (1, 1).
+    REQUIRE(!mesh.is_boundary_vertex(5));
+    REQUIRE(to_sorted_vector(mesh.vertex_neighbors(5))
+            == std::vector<Xyz::VertexId>{0, 1, 4, 6, 9, 10});
+    REQUIRE(to_sorted_vector(mesh.vertex_neighbors(0))
+            == std::vector<Xyz::VertexId>{1, 4, 5});
+    REQUIRE(to_sorted_vector(mesh.vertex_neighbors(3))
+            == std::vector<Xyz::VertexId>{2, 7});
+}
+
+TEST_CASE("HalfEdgeMesh: non-manifold edges and isolated vertexes")
+{
+    // Three triangles share the edge 0-1.
+    const std::vector<uint32_t> indexes{0, 1, 2, 1, 0, 3, 1, 0, 4};
+    const Xyz::HalfEdgeMesh mesh(indexes, 6);
+    REQUIRE(mesh.twin(0) == 3);
+    REQUIRE(mesh.is_boundary(6));
+    REQUIRE(mesh.vertex_half_edge(5) == Xyz::INVALID_HALF_EDGE_ID);
+    REQUIRE(to_vector(mesh.vertex_neighbors(5)).empty());
+    REQUIRE(to_vector(mesh.outgoing_half_edges(5)).empty());
+}
+
+TEST_CASE("HalfEdgeMesh: invalid indexes")
+{
+    REQUIRE_THROWS_AS(Xyz::HalfEdgeMesh(std::vector<int>{0, 1}, 2),
+                      std::invalid_argument);
+    REQUIRE_THROWS_AS(Xyz::HalfEdgeMesh(std::vector<int>{0, 1, 2}, 2),
+                      std::invalid_argument);
+    REQUIRE_THROWS_AS(Xyz::HalfEdgeMesh(std::vector<int>{0, -1, 1}, 2),
+                      std::invalid_argument);
+    REQUIRE(Xyz::HalfEdgeMesh(std::vector<int>{}, 0).face_count() == 0);
+}
@@ -0,0 +1,139 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Xyz/Mesh/Heightfield.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace
+{
+    using Builder2D = Xyz::MeshAttributeBuilder<Xyz::Vector2D, std::vector<double>>;
+    using Builder3D = Xyz::MeshAttributeBuilder<Xyz::Vector3D, std::vector<double>>;
+    using Builder4D = Xyz::MeshAttributeBuilder<Xyz::Vector4D, std::vector<double>>;
+
+    struct Mesh
+    {
+        std::vector<uint32_t> indexes;
+        std::vector<double> vertexes;
+
+        [[nodiscard]] Xyz::Vector3D get(size_t vertex, size_t offset) const
+        {
+            const auto* v = vertexes.data() + vertex * 12 + offset;
+            return {v[0], v[1], v[2]};
+        }
+    };
+
+    template <typename HeightFunc>
+    Mesh build(const Xyz::Heightfield<double>& field,
+               const HeightFunc& height,
+               unsigned thread_count)
+    {
+        // Interleaved: coords, normals, tangents (4) and tex_coords.
+        Mesh mesh;
+        Xyz::MeshBuilder builder{
+            .indexes = Xyz::MeshIndexBuilder<uint32_t>(mesh.indexes),
+            .coords = Builder3D(mesh.vertexes, 12),
+            .normals = std::optional(Builder3D(mesh.vertexes, 12, 3)),
+            .tangents = std::optional(Builder4D(mesh.vertexes, 12, 6)),
+            .tex_coords = std::optional(Builder2D(mesh.vertexes, 12, 10))
+        };
+        Xyz::build_mesh(builder, field, height, {{0, 0}, {1, 1}}, 0,
+                        thread_count);
+        const auto size = Xyz::predict_mesh_size(field);
+        REQUIRE(builder.coords.size() == size.vertexes);
+        REQUIRE(builder.tex_coords->size() == size.vertexes);
+        REQUIRE(mesh.vertexes.size() == 12 * size.vertexes);
+        REQUIRE(mesh.indexes.size() == size.indexes);
+        return mesh;
+    }
+}
+
+TEST_CASE("Heightfield: analytic surface")
+{
+    Xyz::Heightfield<double> field{{{{1, 2, 3}, {}}, {4, 2}}, 8, 4};
+    auto height = [](double x, double y) {return 2 * x + y;};
+    const auto mesh = build(field, height, 1);
+    REQUIRE(Xyz::predict_mesh_size(field) == Xyz::MeshSize{45, 192});
+
+    const auto expected_normal = Xyz::normalize(Xyz::Vector3D(-2, -1, 1));
+    const auto expected_tangent = Xyz::normalize(Xyz::Vector3D(1, 0, 2));
+    for (size_t j = 0; j <= 4; ++j)
+    {
+        for (size_t i = 0; i <= 8; ++i)
+        {
+            const auto n = j * 9 + i;
+            const auto x = 0.5 * double(i);
+            const auto y = 0.5 * double(j);
+            REQUIRE(Xyz::are_equal(mesh.get(n, 0),
+                                   Xyz::Vector3D(1 + x, 2 + y,
+                                                 3 + height(x, y))));
+            REQUIRE(Xyz::are_equal(mesh.get(n, 3), expected_normal));
+            REQUIRE(Xyz::are_equal(mesh.get(n, 6), expected_tangent));
+            REQUIRE(mesh.vertexes[n * 12 + 9] == 1);
+            REQUIRE(mesh.vertexes[n * 12 + 10] == double(i) / 8);
+            REQUIRE(mesh.vertexes[n * 12 + 11] == double(j) / 4);
+        }
+    }
+
+    // Same winding as GridPlane.
+    REQUIRE(mesh.indexes[0] == 0);
+    REQUIRE(mesh.indexes[1] == 10);
+    REQUIRE(mesh.indexes[2] == 9);
+    REQUIRE(mesh.indexes[3] == 0);
+    REQUIRE(mesh.indexes[4] == 1);
+    REQUIRE(mesh.indexes[5] == 10);
+    REQUIRE(mesh.indexes.back() == 44);
+}
+
+TEST_CASE("Heightfield: the result doesn't depend on the thread count")
+{
+    Xyz::SimplexNoise noise;
+    Xyz::Heightfield<double> field{{{{0, 0, 0}, {}}, {50, 40}}, 200, 160};
+    const Xyz::NoiseHeight<double> height{.noise = &noise, .frequency = 0.1,
+                                          .amplitude = 3, .octaves = 3};
+    const auto single = build(field, height, 1);
+    const auto multi = build(field, height, 4);
+    REQUIRE(single.vertexes == multi.vertexes);
+    REQUIRE(single.indexes == multi.indexes);
+}
+
+TEST_CASE("Heightfield: normals match along the seam between tiles")
+{
+    Xyz::SimplexNoise noise;
+    Xyz::Heightfield<double> left{{{{-10, 0, 0}, {}}, {10, 10}}, 16, 16};
+    Xyz::Heightfield<double> right{{{{0, 0, 0}, {}}, {10, 10}}, 16, 16};
+    Xyz::NoiseHeight<double> height{.noise = &noise, .offset = {-10, 0},
+                                    .frequency = 0.3, .amplitude = 2};
+    const auto left_mesh = build(left, height, 1);
+    height.offset = {0, 0};
+    const auto right_mesh = build(right, height, 1);
+
+    for (size_t j = 0; j <= 16; ++j)
+    {
+        const auto l = j * 17 + 16;
+        const auto r = j * 17;
+        REQUIRE(Xyz::are_equal(left_mesh.get(l, 0), right_mesh.get(r, 0)));
+        REQUIRE(Xyz::are_equal(left_mesh.get(l, 3), right_mesh.get(r, 3)));
+    }
+}
+
+TEST_CASE("Heightfield: base index and existing vertexes")
+{
+    std::vector<uint32_t> indexes{7, 7, 7};
+    std::vector<float> coords(6);
+    Xyz::MeshBuilder builder{
+        .indexes = Xyz::MeshIndexBuilder<uint32_t>(indexes),
+        .coords = Xyz::MeshAttributeBuilder<Xyz::Vector3F, std::vector<float>>(
+            coords, 3, 0, 2)
+    };
+    Xyz::Heightfield<float> field{{{{0, 0, 0}, {}}, {1, 1}}, 1, 1};
+    Xyz::build_mesh(builder, field, [](float, float) {return 1.0f;},
+                    {}, 2);
+    REQUIRE(coords.size() == 18);
+    REQUIRE(coords[17] == 1);
+    REQUIRE(indexes == std::vector<uint32_t>{7, 7, 7, 2, 5, 4, 2, 3, 5});
+}
@@ -58,3 +58,22 @@ TEST_CASE("InvertMatrix: invert5")
     };
     CHECK(equals_identity_matrix(m * invert(m)));
 }
+
+TEST_CASE("InvertMatrix: affine invert")
+{
+    Xyz::Matrix4D m{
+        1, -2, 3, 2,
+        2, 3, 1, -1,
+        3, 7, 0, 3,
+        0, 0, 0, 1
+    };
+    const auto inv = Xyz::affine::invert(m);
+    CHECK(equals_identity_matrix(m * inv));
+    CHECK(Xyz::are_equal(inv, invert(m), 1e-12));
+    CHECK_THROWS(Xyz::affine::invert(Xyz::Matrix4D{
+        1, 2, 3, 4,
+        2, 4, 6, 5,
+        0, 0, 1, 6,
+        0, 0, 0, 1
+    }));
+}
@@ -0,0 +1,171 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Xyz/LineString.hpp>
+
+#include <cmath>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+using Catch::Matchers::WithinAbs;
+
+namespace
+{
+    using LineString2D = Xyz::LineString<double, 2>;
+
+    /**
+     * @brief A wiggly track that doubles back on itself now and then.
+     */
+    std::vector<Xyz::Vector2D> make_track(size_t count)
+    {
+        std::vector<Xyz::Vector2D> points;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto t = 0.05 * double(i);
+            points.push_back({10 * std::cos(0.1 * t) + 0.3 * std::sin(3 * t),
+                              t * std::sin(0.13 * t) + 0.2 * std::cos(5 * t)});
+        }
+        return points;
+    }
+
+    Xyz::LineStringPosition<double, 2>
+    find_nearest_point_brute_force(const LineString2D& ls, const Xyz::Vector2D& p)
+    {
+        Xyz::LineStringPosition<double, 2> result;
+        auto best = std::numeric_limits<double>::max();
+        for (size_t i = 0; i < ls.segment_count(); ++i)
+        {
+            const auto q = get_nearest_point(ls.segment(i), p);
+            const auto d = get_length_squared(q - p);
+            if (d < best)
+            {
+                best = d;
+                result = {q, i, ls.cumulative_lengths()[i] + get_length(q - ls[i])};
+            }
+        }
+        return result;
+    }
+
+    double get_max_deviation(const LineString2D& original,
+                             const LineString2D& simplified)
+    {
+        double result = 0;
+        for (const auto& p : original.points())
+        {
+            const auto q = simplified.find_nearest_point(p).point;
+            result = std::max(result, get_length(q - p));
+        }
+        return result;
+    }
+}
+
+TEST_CASE("LineSegment: get_nearest_point")
+{
+    const Xyz::LineSegment<double, 2> segment({0, 0}, {4, 0});
+    CHECK(get_nearest_point(segment, Xyz::Vector2D(1, 3)) == Xyz::Vector2D(1, 0));
+    CHECK(get_nearest_point(segment, Xyz::Vector2D(-2, 1)) == Xyz::Vector2D(0, 0));
+    CHECK(get_nearest_point(segment, Xyz::Vector2D(5, -1)) == Xyz::Vector2D(4, 0));
+    const Xyz::LineSegment<double, 2> point({1, 1}, {1, 1});
+    CHECK(get_nearest_point(point, Xyz::Vector2D(5, -1)) == Xyz::Vector2D(1, 1));
+}
+
+TEST_CASE("LineString: lengths and point at distance")
+{
+    const std::vector<Xyz::Vector2D> points{{0, 0}, {3, 4}, {3, 4}, {3, 0}};
+    const LineString2D ls(points);
+    REQUIRE(ls.size() == 4);
+    REQUIRE(ls.segment_count() == 3);
+    CHECK(ls.length() == 9);
+    CHECK(ls.cumulative_lengths()[2] == 5);
+
+    auto pos = ls.point_at_distance(2.5);
+    CHECK(are_equal(pos.point, Xyz::Vector2D(1.5, 2)));
+    CHECK(pos.segment == 0);
+    pos = ls.point_at_distance(7);
+    CHECK(are_equal(pos.point, Xyz::Vector2D(3, 2)));
+    CHECK(pos.segment == 2);
+    CHECK(ls.point_at_distance(-1).point == Xyz::Vector2D(0, 0));
+    CHECK(ls.point_at_distance(100).point == Xyz::Vector2D(3, 0));
+    CHECK(ls.point_at_distance(9).segment == 2);
+
+    const std::vector<double> distances{0, 5, 9};
+    std::vector<Xyz::LineStringPosition<double, 2>> result(3);
+    ls.points_at_distances(distances, result);
+    CHECK(result[1].point == Xyz::Vector2D(3, 4));
+
+    const auto box = ls.bounding_box();
+    CHECK(box.min == Xyz::Vector2D(0, 0));
+    CHECK(box.max == Xyz::Vector2D(3, 4));
+
+    CHECK_THROWS(LineString2D().point_at_distance(0));
+}
+
+TEST_CASE("LineString: find_nearest_point matches brute force")
+{
+    const auto track = make_track(2000);
+    const LineString2D ls(track);
+    for (int i = 0; i < 200; ++i)
+    {
+        const Xyz::Vector2D p(-12 + 0.13 * i, -60 + 0.6 * i);
+        CAPTURE(p);
+        const auto expected = find_nearest_point_brute_force(ls, p);
+        const auto actual = ls.find_nearest_point(p);
+        CHECK(actual.segment == expected.segment);
+        CHECK(actual.point == expected.point);
+        CHECK_THAT(actual.distance, WithinAbs(expected.distance, 1e-9));
+    }
+
+    const auto bbox = ls.bounding_box();
+    for (const auto& p : track)
+    {
+        REQUIRE(bbox.min[0] <= p[0]);
+        REQUIRE(p[1] <= bbox.max[1]);
+    }
+}
+
+TEST_CASE("LineString: batched find_nearest_points")
+{
+    const LineString2D ls(make_track(1000));
+    std::vector<Xyz::Vector2D> points;
+    for (int i = 0; i < 1000; ++i)
+        points.push_back({-10 + 0.02 * i, 20 - 0.05 * i});
+
+    std::vector<Xyz::LineStringPosition<double, 2>> result(points.size());
+    ls.find_nearest_points(points, result, 4);
+    for (size_t i = 0; i < points.size(); i += 37)
+        CHECK(result[i].point == ls.find_nearest_point(points[i]).point);
+    CHECK_THROWS(ls.find_nearest_points(points, std::span(result).first(5)));
+}
+
+TEST_CASE("LineString: Douglas-Peucker")
+{
+    const LineString2D ls(make_track(3000));
+    const auto simplified = simplify_douglas_peucker(ls, 0.05);
+    CHECK(simplified.size() < ls.size() / 4);
+    CHECK(simplified[0] == ls[0]);
+    CHECK(simplified[simplified.size() - 1] == ls[ls.size() - 1]);
+    CHECK(get_max_deviation(ls, simplified) <= 0.05);
+
+    const std::vector<Xyz::Vector2D> line{{0, 0}, {1, 0.01}, {2, 0}, {3, 1}};
+    CHECK(simplify_douglas_peucker(LineString2D(line), 0.1).size() == 3);
+}
+
+TEST_CASE("LineString: Visvalingam")
+{
+    const std::vector<Xyz::Vector2D> line{{0, 0}, {1, 0.01}, {2, 0}, {3, 1}, {4, 0}};
+    const auto simplified = simplify_visvalingam(LineString2D(line), 0.1);
+    REQUIRE(simplified.size() == 4);
+    CHECK(simplified[1] == Xyz::Vector2D(2, 0));
+
+    const LineString2D ls(make_track(3000));
+    const auto track = simplify_visvalingam(ls, 0.003);
+    CHECK(track.size() < ls.size() / 2);
+    CHECK(track[0] == ls[0]);
+    CHECK(track[track.size() - 1] == ls[ls.size() - 1]);
+    CHECK(get_max_deviation(ls, track) < 0.1);
+}
@@ -0,0 +1,116 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Xyz/Mesh/OptimizeVertexCache.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Triangle = std::array<uint32_t, 3>;
+
+    // Returns the triangles with their indexes rotated so that the
+    // smallest comes first, sorted. Two index lists describe the same
+    // triangles with the same orientations iff the results are equal.
+    std::vector<Triangle> get_normalized_triangles(const std::vector<uint32_t>& indexes)
+    {
+        std::vector<Triangle> result;
+        for (size_t i = 0; i < indexes.size(); i += 3)
+        {
+            Triangle t = {indexes[i], indexes[i + 1], indexes[i + 2]};
+            std::rotate(t.begin(), std::min_element(t.begin(), t.end()), t.end());
+            result.push_back(t);
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    // A grid of size x size squares with two triangles each, in random
+    // order.
+    std::vector<uint32_t> make_shuffled_grid(uint32_t size)
+    {
+        std::vector<Triangle> triangles;
+        for (uint32_t y = 0; y < size; ++y)
+        {
+            for (uint32_t x = 0; x < size; ++x)
+            {
+                const auto v = y * (size + 1) + x;
+                triangles.push_back({v, v + 1, v + size + 2});
+                triangles.push_back({v, v + size + 2, v + size + 1});
+            }
+        }
+
+        std::default_random_engine engine(42);
+        std::shuffle(triangles.begin(), triangles.end(), engine);
+        std::vector<uint32_t> result;
+        for (const auto& t : triangles)
+            result.insert(result.end(), t.begin(), t.end());
+        return result;
+    }
+}
+
+TEST_CASE("OptimizeVertexCache: statistics")
+{
+    // Two triangles that share an edge.
+    const std::vector<uint32_t> indexes = {0, 1, 2, 2, 1, 3};
+    const auto stats = Xyz::get_vertex_cache_statistics(indexes, 4);
+    CHECK(stats.transformed_vertexes == 4);
+    CHECK(stats.acmr == 2.0);
+    CHECK(stats.atvr == 1.0);
+
+    // With a cache of size 3, vertex 0 has been evicted when it is
+    // used again.
+    const std::vector<uint32_t> indexes2 = {0, 1, 2, 1, 2, 3, 3, 2, 0};
+    CHECK(Xyz::get_vertex_cache_statistics(indexes2, 4, 3).transformed_vertexes == 5);
+    CHECK(Xyz::get_vertex_cache_statistics(indexes2, 4, 4).transformed_vertexes == 4);
+}
+
+TEST_CASE("OptimizeVertexCache: optimize grid")
+{
+    constexpr uint32_t SIZE = 40;
+    constexpr size_t VERTEX_COUNT = (SIZE + 1) * (SIZE + 1);
+    auto indexes = make_shuffled_grid(SIZE);
+    const auto before = Xyz::get_vertex_cache_statistics(indexes, VERTEX_COUNT);
+    const auto triangles = get_normalized_triangles(indexes);
+
+    Xyz::optimize_vertex_cache(indexes, VERTEX_COUNT);
+    const auto after = Xyz::get_vertex_cache_statistics(indexes, VERTEX_COUNT);
+
+    CHECK(get_normalized_triangles(indexes) == triangles);
+    CHECK(before.acmr > 2.5);
+    CHECK(after.acmr < 0.9);
+    CHECK(after.atvr < 1.7);
+}
+
+TEST_CASE("OptimizeVertexCache: optimize vertex fetch")
+{
+    // Vertex i has coordinates (i, 10 * i), vertex 4 is unused.
+    std::vector<float> buffer;
+    for (int i = 0; i < 5; ++i)
+    {
+        buffer.push_back(float(i));
+        buffer.push_back(float(10 * i));
+    }
+    std::vector<uint32_t> indexes = {3, 1, 0, 0, 1, 2};
+
+    CHECK(Xyz::optimize_vertex_fetch(buffer, 2, indexes) == 4);
+    CHECK(indexes == std::vector<uint32_t>{0, 1, 2, 2, 1, 3});
+    CHECK(buffer == std::vector<float>{3, 30, 1, 10, 0, 0, 2, 20, 4, 40});
+}
+
+TEST_CASE("OptimizeVertexCache: invalid arguments")
+{
+    std::vector<uint32_t> indexes = {0, 1};
+    CHECK_THROWS(Xyz::optimize_vertex_cache(indexes, 2));
+    indexes = {0, 1, 2};
+    CHECK_THROWS(Xyz::optimize_vertex_cache(indexes, 2));
+    CHECK_THROWS(Xyz::optimize_vertex_cache(indexes, 3, 3));
+}
@@ -6,6 +6,7 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #include <Xyz/Orientation.hpp>
+#include <vector>
 #include <Xyz/TransformationMatrix.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
@@ -181,3 +182,46 @@ TEST_CASE("Orientation: 2D affine to_matrix defaults to no translation")
     CHECK(are_equal(Xyz::affine::to_matrix(o),
                     Xyz::affine::rotate2(o.angle), 1e-10));
 }
+
+TEST_CASE("Orientation: batched conversions")
+{
+    std::vector<Xyz::Orientation3D> orientations;
+    for (int i = 0; i < 50; ++i)
+    {
+        orientations.push_back({to_radians(-175.0 + 7.0 * i),
+                                to_radians(-85.0 + 3.4 * i),
+                                to_radians(170.0 - 6.5 * i)});
+    }
+
+    std::vector<Xyz::QuaternionD> quaternions(orientations.size());
+    std::vector<Xyz::Matrix3D> matrixes(orientations.size());
+    std::vector<Xyz::Orientation3D> results(orientations.size());
+    for (const auto precision : {Xyz::TrigPrecision::STANDARD,
+                                 Xyz::TrigPrecision::FAST})
+    {
+        const auto margin = precision == Xyz::TrigPrecision::FAST ? 1e-9 : 1e-12;
+        Xyz::to_quaternion(orientations, std::span(quaternions), precision);
+        Xyz::linear::to_matrix(orientations, std::span(matrixes), precision);
+        Xyz::to_orientation(quaternions, std::span(results), precision);
+        for (size_t i = 0; i < orientations.size(); ++i)
+        {
+            CAPTURE(i);
+            CHECK(are_equal(quaternions[i], to_quaternion(orientations[i]), margin));
+            CHECK(are_equal(matrixes[i], Xyz::linear::to_matrix(orientations[i]), margin));
+            CHECK_THAT(results[i].yaw, WithinAbs(orientations[i].yaw, margin));
+            CHECK_THAT(results[i].pitch, WithinAbs(orientations[i].pitch, margin));
+            CHECK_THAT(results[i].roll, WithinAbs(orientations[i].roll, margin));
+        }
+    }
+
+    CHECK_THROWS(Xyz::to_quaternion(orientations, std::span(quaternions).first(1)));
+}
+
+TEST_CASE("Orientation: 3D affine to_matrix")
+{
+    const Xyz::Orientation3D o(to_radians(30.0), to_radians(20.0), to_radians(10.0));
+    const Xyz::Vector3D offset(1, 2, 3);
+    CHECK(are_equal(Xyz::affine::to_matrix(o, offset),
+                    Xyz::affine::translate3(offset)
+                    * Xyz::affine::to_matrix(to_quaternion(o)), 1e-12));
+}
@@ -0,0 +1,164 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Xyz/FitOrientedCuboid.hpp>
+#include <Xyz/OrientedCuboidIntersection.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <vector>
+
+using Catch::Matchers::WithinAbs;
+
+namespace
+{
+    using V3 = Xyz::Vector3D;
+
+    Xyz::OrientedCuboid<double> make_cuboid(const V3& origin,
+                                            double yaw,
+                                            const V3& size)
+    {
+        return {{origin, {yaw, 0, 0}}, size};
+    }
+
+    // Returns true if point is inside cuboid, with a small margin.
+    bool contains(const Xyz::OrientedCuboid<double>& cuboid, const V3& point)
+    {
+        const auto [x, y, z] = get_vectors(cuboid.placement.orientation);
+        const auto d = point - cuboid.placement.origin;
+        const V3 p(dot(d, x), dot(d, y), dot(d, z));
+        for (unsigned i = 0; i < 3; ++i)
+        {
+            if (p[i] < -1e-9 || p[i] > cuboid.size[i] + 1e-9)
+                return false;
+        }
+        return true;
+    }
+}
+
+TEST_CASE("OrientedCuboid: get_center")
+{
+    const auto c = make_cuboid({1, 1, 1}, Xyz::Constants<double>::PI / 2,
+                               {2, 4, 6});
+    CHECK(are_equal(get_center(c), V3(-1, 2, 4), 1e-12));
+}
+
+TEST_CASE("OrientedCuboid: fit to points")
+{
+    // The corners and some interior points of a 8 x 2 x 1 box that is
+    // rotated 30 degrees around the z-axis and moved away from the origin.
+    const auto angle = Xyz::to_radians(30.0);
+    const auto expected = make_cuboid({100, -50, 10}, angle, {8, 2, 1});
+    const auto [x, y, z] = get_vectors(expected);
+    std::vector<V3> points;
+    for (int i = 0; i <= 8; ++i)
+    {
+        for (int j = 0; j <= 2; ++j)
+        {
+            for (int k = 0; k <= 1; ++k)
+            {
+                points.push_back(expected.placement.origin
+                                 + x * (i / 8.0) + y * (j / 2.0)
+                                 + z * double(k));
+            }
+        }
+    }
+
+    const auto cuboid = Xyz::fit_oriented_cuboid(std::span<const V3>(points));
+    CHECK_THAT(cuboid.size[0], WithinAbs(8, 1e-9));
+    CHECK_THAT(cuboid.size[1], WithinAbs(2, 1e-9));
+    CHECK_THAT(cuboid.size[2], WithinAbs(1, 1e-9));
+    CHECK(are_equal(get_center(cuboid), get_center(expected), 1e-9));
+    for (const auto& p : points)
+        CHECK(contains(cuboid, p));
+
+    // The longest axis is parallel to the box's longest edge.
+    const auto [cx, cy, cz] = get_vectors(cuboid.placement.orientation);
+    CHECK_THAT(std::abs(dot(cx, normalize(x))), WithinAbs(1, 1e-9));
+    // The axes are right-handed.
+    CHECK(are_equal(cross(cx, cy), cz, 1e-9));
+}
+
+TEST_CASE("OrientedCuboid: fit to empty and single point")
+{
+    const std::vector<V3> empty;
+    const auto c0 = Xyz::fit_oriented_cuboid(std::span<const V3>(empty));
+    CHECK(c0.size == V3());
+
+    const std::vector<V3> one = {{1, 2, 3}};
+    const auto c1 = Xyz::fit_oriented_cuboid(std::span<const V3>(one));
+    CHECK(c1.size == V3());
+    CHECK(are_equal(c1.placement.origin, V3(1, 2, 3), 1e-12));
+}
+
+TEST_CASE("OrientedCuboid: intersects OrientedCuboid")
+{
+    const auto pi = Xyz::Constants<double>::PI;
+    const auto a = make_cuboid({0, 0, 0}, 0, {2, 2, 2});
+
+    SECTION("Overlapping axis-aligned")
+    {
+        CHECK(intersects(a, make_cuboid({1, 1, 1}, 0, {2, 2, 2})));
+    }
+    SECTION("Touching")
+    {
+        CHECK(intersects(a, make_cuboid({2, 0, 0}, 0, {2, 2, 2})));
+    }
+    SECTION("Separated along a face axis")
+    {
+        CHECK_FALSE(intersects(a, make_cuboid({2.1, 0, 0}, 0, {2, 2, 2})));
+    }
+    SECTION("Rotated corner pokes into the cuboid")
+    {
+        // A 2x2 square rotated 45 degrees with its left corner at x = 1.9.
+        const auto b = make_cuboid({1.9, 1, 0}, -pi / 4, {2, 2, 2});
+        CHECK(intersects(a, b));
+        CHECK(intersects(b, a));
+    }
+    SECTION("Rotated cuboid close to the corner")
+    {
+        // The bounding boxes overlap, but the cuboids don't.
+        const auto b = make_cuboid({3, 3 - std::sqrt(2.0), 0},
+                                   pi / 4, {2, 2, 2});
+        CHECK_FALSE(intersects(a, b));
+        CHECK_FALSE(intersects(b, a));
+    }
+    SECTION("Separated along a cross product axis")
+    {
+        // Two long rods that are rolled 45 degrees, one along the x-axis
+        // and one along the y-axis above it. Only the z-axis, which is the
+        // cross product of their x-axes, separates them.
+        const auto s = std::sqrt(0.5);
+        const Xyz::OrientedCuboid<double> r1{{{-5, 0, -s}, {0, 0, pi / 4}},
+                                             {10, 1, 1}};
+        const Xyz::OrientedCuboid<double> r2{{{0, -5, s + 0.05},
+                                              {pi / 2, 0, pi / 4}},
+                                             {10, 1, 1}};
+        const Xyz::OrientedCuboid<double> r3{{{0, -5, s - 0.05},
+                                              {pi / 2, 0, pi / 4}},
+                                             {10, 1, 1}};
+        CHECK_FALSE(intersects(r1, r2));
+        CHECK_FALSE(intersects(r2, r1));
+        CHECK(intersects(r1, r3));
+    }
+    SECTION("Negative size")
+    {
+        CHECK(intersects(a, make_cuboid({3, 0, 0}, 0, {-2, 2, 2})));
+    }
+}
+
+TEST_CASE("OrientedCuboid: intersects BBox")
+{
+    const auto pi = Xyz::Constants<double>::PI;
+    const Xyz::BBox3D box({0, 0, 0}, {2, 2, 2});
+    const auto c = make_cuboid({3, 3 - std::sqrt(2.0), 0},
+                               pi / 4, {2, 2, 2});
+    CHECK_FALSE(intersects(c, box));
+    CHECK(intersects(make_cuboid({1.9, 1, 0}, -pi / 4, {2, 2, 2}), box));
+    CHECK(intersects(box, make_cuboid({1.9, 1, 0}, -pi / 4, {2, 2, 2})));
+    CHECK_FALSE(intersects(c, Xyz::BBox3D()));
+}
@@ -0,0 +1,121 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Xyz/Mesh/PagedMeshBuilder.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <Xyz/Mesh/BuildMesh.hpp>
+#include <Xyz/Mesh/Primitives.hpp>
+
+namespace
+{
+    using Builder2F = Xyz::MeshAttributeBuilder<Xyz::Vector2F, std::vector<float>>;
+    using Builder3F = Xyz::MeshAttributeBuilder<Xyz::Vector3F, std::vector<float>>;
+
+    std::vector<Xyz::OrientedCuboid<float>> make_cuboids(size_t count)
+    {
+        std::vector<Xyz::OrientedCuboid<float>> result;
+        for (size_t i = 0; i < count; ++i)
+            result.push_back({{{float(i), 0, 0}, {}}, {1, 2, 3}});
+        return result;
+    }
+}
+
+TEST_CASE("PagedMeshBuilder: pages put together equal a single mesh")
+{
+    const auto cuboids = make_cuboids(10);
+
+    std::vector<uint32_t> expected_indexes;
+    std::vector<float> expected_vertexes;
+    Xyz::MeshBuilder builder{
+        .indexes = Xyz::MeshIndexBuilder<uint32_t>(expected_indexes),
+        .coords = Builder3F(expected_vertexes, 8),
+        .normals = std::optional(Builder3F(expected_vertexes, 8, 3)),
+        .tex_coords = std::optional(Builder2F(expected_vertexes, 8, 6))
+    };
+    for (const auto& cuboid : cuboids)
+        Xyz::build_mesh(builder, cuboid, {}, uint32_t(builder.coords.size()));
+
+    std::vector<uint16_t> indexes;
+    std::vector<float> vertexes;
+    std::vector<size_t> page_vertexes;
+    Xyz::PagedMeshBuilder<std::vector<float>, float, uint16_t> paged(
+        {.stride = 8, .normals = 3, .tex_coords = 6},
+        {100, 150},
+        [&](const auto& page)
+        {
+            REQUIRE(page.first_vertex == vertexes.size() / 8);
+            REQUIRE(page.first_index == indexes.size());
+            for (const auto index : page.indexes)
+                indexes.push_back(uint16_t(index + page.first_vertex));
+            vertexes.insert(vertexes.end(),
+                            page.vertexes.begin(), page.vertexes.end());
+            page_vertexes.push_back(page.vertexes.size() / 8);
+        });
+
+    for (const auto& cuboid : cuboids)
+        paged.add(cuboid);
+    REQUIRE(paged.page_count() == 2);
+    REQUIRE(paged.vertex_count() == 240);
+    REQUIRE(paged.index_count() == 360);
+    paged.flush();
+    paged.flush();
+
+    // Four cuboids (96 vertexes, 144 indexes) fit in each page.
+    REQUIRE(page_vertexes == std::vector<size_t>{96, 96, 48});
+    REQUIRE(vertexes == expected_vertexes);
+    REQUIRE(indexes.size() == expected_indexes.size());
+    for (size_t i = 0; i < indexes.size(); ++i)
+        REQUIRE(indexes[i] == expected_indexes[i]);
+}
+
+TEST_CASE("PagedMeshBuilder: a shape larger than a page gets its own page")
+{
+    std::vector<size_t> page_vertexes;
+    Xyz::PagedMeshBuilder<std::vector<double>, double, uint32_t> paged(
+        {.stride = 3},
+        {30, 60},
+        [&](const auto& page)
+        {
+            for (const auto index : page.indexes)
+                REQUIRE(index < page.vertexes.size() / 3);
+            page_vertexes.push_back(page.vertexes.size() / 3);
+        });
+
+    paged.add(Xyz::OrientedCuboid<double>());
+    paged.add(Xyz::UvSphere<double>{{}, 1, 8, 4});
+    paged.add(Xyz::OrientedCuboid<double>(),
+              [](int) {return Xyz::Rectangle<double>({0, 0}, {1, 1});});
+    paged.flush();
+    REQUIRE(page_vertexes == std::vector<size_t>{24, 45, 24});
+}
+
+TEST_CASE("PagedMeshBuilder: custom build function")
+{
+    size_t pages = 0;
+    Xyz::PagedMeshBuilder<std::vector<float>, float> paged(
+        {}, {8, 8}, [&](const auto&) {++pages;});
+    paged.add({3, 3}, [](auto& builder, uint32_t base)
+    {
+        builder.coords.add({0, 0, 0});
+        builder.coords.add({1, 0, 0});
+        builder.coords.add({0, 1, 0});
+        builder.indexes.add(base, base + 1, base + 2);
+    });
+    REQUIRE_THROWS_AS(paged.add({1, 0}, [](auto&, uint32_t) {}),
+                      std::logic_error);
+}
+
+TEST_CASE("PagedMeshBuilder: invalid page sizes")
+{
+    using Paged = Xyz::PagedMeshBuilder<std::vector<float>, float, uint8_t>;
+    auto sink = [](const Paged::Page&) {};
+    REQUIRE_THROWS_AS(Paged({}, {0, 3}, sink), std::invalid_argument);
+    REQUIRE_THROWS_AS(Paged({}, {257, 3}, sink), std::invalid_argument);
+    REQUIRE_NOTHROW(Paged({}, {256, 3}, sink));
+}
@@ -0,0 +1,80 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Xyz/PointStatistics.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <vector>
+
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("PointStatistics: centroid and covariance of a small set")
+{
+    using V = Xyz::Vector2D;
+    const std::vector<V> points = {{1, 2}, {3, 2}, {1, 4}, {3, 4}};
+    const auto stats = Xyz::compute_point_statistics(std::span<const V>(points));
+
+    REQUIRE(stats.count == 4);
+    REQUIRE(stats.bbox.min == V(1, 2));
+    REQUIRE(stats.bbox.max == V(3, 4));
+    REQUIRE(are_equal(stats.centroid, V(2, 3)));
+    CHECK_THAT((stats.covariance[0, 0]), WithinAbs(1, 1e-12));
+    CHECK_THAT((stats.covariance[1, 1]), WithinAbs(1, 1e-12));
+    CHECK_THAT((stats.covariance[0, 1]), WithinAbs(0, 1e-12));
+    CHECK_THAT((stats.covariance[1, 0]), WithinAbs(0, 1e-12));
+}
+
+TEST_CASE("PointStatistics: covariance of correlated points far from the origin")
+{
+    // Points along the line y = 2x, offset far from the origin. The naive
+    // one-pass formula loses all precision here.
+    using V = Xyz::Vector3F;
+    std::vector<V> points;
+    for (int i = 0; i <= 100; ++i)
+    {
+        const float t = float(i - 50) / 10;
+        points.emplace_back(1e5f + t, 1e5f + 2 * t, 1e5f);
+    }
+
+    const auto stats = Xyz::compute_point_statistics(std::span<const V>(points));
+    REQUIRE(are_equal(stats.centroid, V(1e5f, 1e5f, 1e5f)));
+
+    // The variance of t is sum((i/10)^2, i=-50..50) / 101 = 8.5
+    CHECK_THAT((stats.covariance[0, 0]), WithinAbs(8.5, 1e-2));
+    CHECK_THAT((stats.covariance[0, 1]), WithinAbs(17, 1e-2));
+    CHECK_THAT((stats.covariance[1, 1]), WithinAbs(34, 1e-2));
+    CHECK_THAT((stats.covariance[2, 2]), WithinAbs(0, 1e-6));
+}
+
+TEST_CASE("PointStatistics: threads give the same result")
+{
+    using V = Xyz::Vector3D;
+    std::vector<V> points;
+    for (int i = 0; i < 200000; ++i)
+        points.emplace_back(i % 101, (i * 31) % 97, std::sin(i));
+
+    const auto single = Xyz::compute_point_statistics(std::span<const V>(points));
+    const auto multi = Xyz::compute_point_statistics(std::span<const V>(points), 3);
+
+    REQUIRE(multi.count == single.count);
+    REQUIRE(multi.bbox.min == single.bbox.min);
+    REQUIRE(multi.bbox.max == single.bbox.max);
+    REQUIRE(are_equal(multi.centroid, single.centroid, 1e-18));
+    REQUIRE(are_equal(multi.covariance, single.covariance, 1e-9));
+
+    const auto centroid = Xyz::compute_centroid(std::span<const V>(points), 3);
+    REQUIRE(are_equal(centroid, single.centroid, 1e-18));
+}
+
+TEST_CASE("PointStatistics: empty span")
+{
+    const auto stats = Xyz::compute_point_statistics(std::span<const Xyz::Vector2F>());
+    REQUIRE(stats.count == 0);
+    REQUIRE(!stats.bbox);
+    REQUIRE(Xyz::compute_centroid(std::span<const Xyz::Vector2F>()) == Xyz::Vector2F());
+}
@@ -0,0 +1,151 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Xyz/Predicates.hpp>
+
+#include <cmath>
+#include <catch2/catch_test_macros.hpp>
+
+#include <Xyz/LineLineIntersection.hpp>
+#include <Xyz/Triangle.hpp>
+
+namespace
+{
+    using V2 = Xyz::Vector2D;
+    using V3 = Xyz::Vector3D;
+
+    int sign(double value)
+    {
+        return value > 0 ? 1 : (value < 0 ? -1 : 0);
+    }
+
+    /**
+     * @brief Returns @a value moved @a steps doubles up or down.
+     */
+    double nudge(double value, int steps)
+    {
+        for (; steps > 0; --steps)
+            value = std::nextafter(value, INFINITY);
+        for (; steps < 0; ++steps)
+            value = std::nextafter(value, -INFINITY);
+        return value;
+    }
+}
+
+TEST_CASE("Predicates: orient2d")
+{
+    CHECK(Xyz::orient2d(V2(0, 0), V2(1, 0), V2(0, 1)) == 1);
+    CHECK(Xyz::orient2d(V2(0, 0), V2(0, 1), V2(1, 0)) == -1);
+    CHECK(Xyz::orient2d(V2(0, 0), V2(1, 1), V2(3, 3)) == 0);
+}
+
+TEST_CASE("Predicates: orient2d with nearly colinear points")
+{
+    // Shewchuk's example: a point near (0.5, 0.5) and the line through
+    // (12, 12) and (24, 24). The point is to the left of the line if its
+    // y coordinate is greater than its x coordinate. Plain double
+    // arithmetic gets many of these wrong.
+    const V2 b(12, 12);
+    const V2 c(24, 24);
+    for (int i = 0; i < 32; ++i)
+    {
+        for (int j = 0; j < 32; ++j)
+        {
+            const V2 a(nudge(0.5, i), nudge(0.5, j));
+            CAPTURE(i, j);
+            REQUIRE(sign(Xyz::orient2d(a, b, c)) == sign(j - i));
+            // The sign is consistent under cyclic permutations.
+            REQUIRE(sign(Xyz::orient2d(b, c, a)) == sign(j - i));
+            REQUIRE(sign(Xyz::orient2d(b, a, c)) == -sign(j - i));
+        }
+    }
+}
+
+TEST_CASE("Predicates: orient3d")
+{
+    const V3 a(0, 0, 0), b(1, 0, 0), c(0, 1, 0);
+    CHECK(Xyz::orient3d(a, b, c, V3(0, 0, -1)) > 0);
+    CHECK(Xyz::orient3d(a, b, c, V3(0, 0, 1)) < 0);
+    CHECK(Xyz::orient3d(a, b, c, V3(3, 4, 0)) == 0);
+
+    // Points near the vertical plane x = y.
+    const V3 p(12, 12, 5), q(24, 24, -3), r(1, 1, 7);
+    const auto s = sign(Xyz::orient3d(p, q, r, V3(0, 1, 2)));
+    REQUIRE(s != 0);
+    for (int i = 0; i < 16; ++i)
+    {
+        for (int j = 0; j < 16; ++j)
+        {
+            const V3 d(nudge(0.5, i), nudge(0.5, j), 2);
+            CAPTURE(i, j);
+            REQUIRE(sign(Xyz::orient3d(p, q, r, d)) == s * sign(j - i));
+        }
+    }
+}
+
+TEST_CASE("Predicates: incircle")
+{
+    // A circle with radius 1 around (1000, 1000).
+    const V2 a(1001, 1000), b(1000, 1001), c(999, 1000);
+    REQUIRE(Xyz::orient2d(a, b, c) > 0);
+    CHECK(Xyz::incircle(a, b, c, V2(1000, 1000)) > 0);
+    CHECK(Xyz::incircle(a, b, c, V2(1000, 999)) == 0);
+    CHECK(Xyz::incircle(a, b, c, V2(1002, 1000)) < 0);
+    for (int i = 1; i < 8; ++i)
+    {
+        CAPTURE(i);
+        CHECK(Xyz::incircle(a, b, c, V2(1000, nudge(999, i))) > 0);
+        CHECK(Xyz::incircle(a, b, c, V2(1000, nudge(999, -i))) < 0);
+        CHECK(Xyz::incircle(b, c, a, V2(1000, nudge(999, i))) > 0);
+    }
+}
+
+TEST_CASE("Predicates: insphere")
+{
+    // A sphere with radius 1 around (1000, 1000, 1000).
+    V3 a(1001, 1000, 1000), b(1000, 1001, 1000), c(1000, 1000, 1001), d(999, 1000, 1000);
+    if (Xyz::orient3d(a, b, c, d) < 0)
+        std::swap(a, b);
+    CHECK(Xyz::insphere(a, b, c, d, V3(1000, 1000, 1000)) > 0);
+    CHECK(Xyz::insphere(a, b, c, d, V3(1000, 1000, 999)) == 0);
+    CHECK(Xyz::insphere(a, b, c, d, V3(1000, 1000, 998)) < 0);
+    for (int i = 1; i < 8; ++i)
+    {
+        CAPTURE(i);
+        CHECK(Xyz::insphere(a, b, c, d, V3(1000, 1000, nudge(999, i))) > 0);
+        CHECK(Xyz::insphere(a, b, c, d, V3(1000, 1000, nudge(999, -i))) < 0);
+    }
+}
+
+TEST_CASE("Predicates: exact contains_point for Triangle")
+{
+    const Xyz::Triangle<double, 2> tri(V2(0.5, 0.5), V2(24, 24), V2(0, 24));
+    CHECK(contains_point(tri, V2(5, 10)));
+    CHECK(!contains_point(tri, V2(12, 12)));
+    CHECK(contains_point_inclusive(tri, V2(12, 12)));
+    // Points just off the edge from (0.5, 0.5) to (24, 24).
+    CHECK(contains_point(tri, V2(12, nudge(12, 1))));
+    CHECK(!contains_point_inclusive(tri, V2(12, nudge(12, -1))));
+}
+
+TEST_CASE("Predicates: exact get_intersection_type for segments")
+{
+    using Segment = Xyz::LineSegment<double, 2>;
+    const Segment a(V2(12, 12), V2(24, 24));
+    CHECK(get_intersection_type(a, Segment(V2(12, 24), V2(24, 12)))
+          == Xyz::IntersectionType::INTERSECTING);
+    CHECK(get_intersection_type(a, Segment(V2(18, 18), V2(24, 12)))
+          == Xyz::IntersectionType::NON_INTERSECTING);
+    CHECK(get_intersection_type(a, Segment(V2(0, 0), V2(30, 30)))
+          == Xyz::IntersectionType::COLINEAR);
+    // The end point of the second segment is barely across the first.
+    const auto y = nudge(18, 1);
+    CHECK(get_intersection_type(a, Segment(V2(18, 30), V2(18, nudge(y, -2))))
+          == Xyz::IntersectionType::INTERSECTING);
+    CHECK(get_intersection_type(a, Segment(V2(18, 30), V2(18, y)))
+          == Xyz::IntersectionType::NON_INTERSECTING);
+}
@@ -0,0 +1,265 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Xyz/Mesh/Primitives.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <functional>
+
+namespace
+{
+    using Builder2D = Xyz::MeshAttributeBuilder<Xyz::Vector2D, std::vector<double>>;
+    using Builder3D = Xyz::MeshAttributeBuilder<Xyz::Vector3D, std::vector<double>>;
+    using Builder4D = Xyz::MeshAttributeBuilder<Xyz::Vector4D, std::vector<double>>;
+
+    struct Mesh
+    {
+        std::vector<uint32_t> indexes;
+        std::vector<double> coords;
+        std::vector<double> normals;
+        std::vector<double> tangents;
+        std::vector<double> tex_coords;
+
+        [[nodiscard]] size_t vertex_count() const
+        {
+            return coords.size() / 3;
+        }
+
+        [[nodiscard]] Xyz::Vector3D coord(size_t i) const
+        {
+            return {coords[3 * i], coords[3 * i + 1], coords[3 * i + 2]};
+        }
+
+        [[nodiscard]] Xyz::Vector3D normal(size_t i) const
+        {
+            return {normals[3 * i], normals[3 * i + 1], normals[3 * i + 2]};
+        }
+
+        [[nodiscard]] Xyz::Vector3D tangent(size_t i) const
+        {
+            return {tangents[4 * i], tangents[4 * i + 1], tangents[4 * i + 2]};
+        }
+    };
+
+    template <typename Shape>
+    Mesh build(const Shape& shape)
+    {
+        Mesh mesh;
+        Xyz::MeshBuilder builder{
+            .indexes = Xyz::MeshIndexBuilder<uint32_t>(mesh.indexes),
+            .coords = Builder3D(mesh.coords, 3),
+            .normals = std::optional(Builder3D(mesh.normals, 3)),
+            .tangents = std::optional(Builder4D(mesh.tangents, 4)),
+            .tex_coords = std::optional(Builder2D(mesh.tex_coords, 2))
+        };
+        Xyz::build_mesh(builder, shape, {{0, 0}, {1, 1}});
+
+        const auto size = Xyz::predict_mesh_size(shape);
+        REQUIRE(mesh.vertex_count() == size.vertexes);
+        REQUIRE(mesh.indexes.size() == size.indexes);
+        REQUIRE(mesh.normals.size() == 3 * size.vertexes);
+        REQUIRE(mesh.tangents.size() == 4 * size.vertexes);
+        REQUIRE(mesh.tex_coords.size() == 2 * size.vertexes);
+        return mesh;
+    }
+
+    /**
+     * @brief Checks the properties every primitive mesh must have.
+     */
+    void check_mesh(const Mesh& mesh,
+                    const std::function<bool(const Xyz::Vector3D&)>& on_surface)
+    {
+        for (size_t i = 0; i < mesh.vertex_count(); ++i)
+        {
+            REQUIRE(on_surface(mesh.coord(i)));
+            const auto n = mesh.normal(i);
+            const auto t = mesh.tangent(i);
+            REQUIRE(std::abs(Xyz::get_length(n) - 1) < 1e-9);
+            REQUIRE(std::abs(Xyz::get_length(t) - 1) < 1e-9);
+            REQUIRE(std::abs(Xyz::dot(n, t)) < 1e-9);
+            REQUIRE(std::abs(mesh.tangents[4 * i + 3]) == 1);
+            REQUIRE(mesh.tex_coords[2 * i] >= -1e-9);
+            REQUIRE(mesh.tex_coords[2 * i + 1] >= -1e-9);
+            REQUIRE(mesh.tex_coords[2 * i + 1] <= 1 + 1e-9);
+        }
+
+        // All triangles are counterclockwise as seen from the side the
+        // vertex normals point to.
+        for (size_t i = 0; i < mesh.indexes.size(); i += 3)
+        {
+            const auto a = mesh.indexes[i];
+            const auto b = mesh.indexes[i + 1];
+            const auto c = mesh.indexes[i + 2];
+            REQUIRE(a < mesh.vertex_count());
+            REQUIRE(b < mesh.vertex_count());
+            REQUIRE(c < mesh.vertex_count());
+            const auto face = Xyz::cross(mesh.coord(b) - mesh.coord(a),
+                                         mesh.coord(c) - mesh.coord(a));
+            REQUIRE(Xyz::get_length(face) > 1e-12);
+            const auto n = mesh.normal(a) + mesh.normal(b) + mesh.normal(c);
+            REQUIRE(Xyz::dot(face, n) > 0);
+        }
+    }
+
+    bool is_close(double a, double b)
+    {
+        return std::abs(a - b) < 1e-9;
+    }
+}
+
+TEST_CASE("Primitives: UvSphere")
+{
+    Xyz::UvSphere<double> sphere{{{1, 2, 3}, {0.3, 0.2, 0.1}}, 2, 12, 7};
+    const auto mesh = build(sphere);
+    REQUIRE(Xyz::predict_mesh_size(sphere) == Xyz::MeshSize{13 * 8, 6 * 12 * 6});
+    check_mesh(mesh, [&](auto& p)
+    {
+        return is_close(Xyz::get_length(p - sphere.placement.origin), 2);
+    });
+
+    for (size_t i = 0; i < mesh.vertex_count(); ++i)
+    {
+        const auto expected = (mesh.coord(i) - sphere.placement.origin) / 2.0;
+        REQUIRE(Xyz::get_length(mesh.normal(i) - expected) < 1e-9);
+    }
+}
+
+TEST_CASE("Primitives: IcoSphere")
+{
+    Xyz::IcoSphere<double> sphere{{{1, 2, 3}, {}}, 3, 3};
+    const auto mesh = build(sphere);
+    REQUIRE(Xyz::predict_mesh_size(sphere) == Xyz::MeshSize{200, 540});
+    check_mesh(mesh, [&](auto& p)
+    {
+        return is_close(Xyz::get_length(p - sphere.placement.origin), 3);
+    });
+
+    // No triangle stretches across the texture seam. Triangles near the
+    // poles span large ranges of u anyway.
+    for (size_t i = 0; i < mesh.indexes.size(); i += 3)
+    {
+        if (std::abs(mesh.normal(mesh.indexes[i])[2]) > 0.7)
+            continue;
+        const auto u0 = mesh.tex_coords[2 * mesh.indexes[i]];
+        const auto u1 = mesh.tex_coords[2 * mesh.indexes[i + 1]];
+        const auto u2 = mesh.tex_coords[2 * mesh.indexes[i + 2]];
+        REQUIRE(std::max({u0, u1, u2}) - std::min({u0, u1, u2}) < 0.25);
+    }
+}
+
+TEST_CASE("Primitives: Cylinder")
+{
+    Xyz::Cylinder<double> cylinder{{{1, 2, 3}, {0, 0.5, 0}}, 2, 5, 16};
+    const auto mesh = build(cylinder);
+    REQUIRE(Xyz::predict_mesh_size(cylinder) == Xyz::MeshSize{68, 192});
+    const auto [x, y, z] = Xyz::get_vectors(cylinder.placement.orientation);
+    check_mesh(mesh, [&](auto& p)
+    {
+        const auto d = p - cylinder.placement.origin;
+        const auto h = Xyz::dot(d, z);
+        const auto r = Xyz::get_length(d - h * z);
+        const bool on_side = is_close(r, 2) && h > -1e-9 && h < 5 + 1e-9;
+        const bool on_cap = (is_close(h, 0) || is_close(h, 5)) && r < 2 + 1e-9;
+        return on_side || on_cap;
+    });
+
+    cylinder.caps = false;
+    const auto open = build(cylinder);
+    REQUIRE(open.vertex_count() == 34);
+    REQUIRE(open.indexes.size() == 96);
+}
+
+TEST_CASE("Primitives: Cone")
+{
+    Xyz::Cone<double> cone{{{0, 0, 0}, {}}, 1, 2, 8};
+    const auto mesh = build(cone);
+    REQUIRE(Xyz::predict_mesh_size(cone) == Xyz::MeshSize{26, 48});
+    check_mesh(mesh, [&](auto& p)
+    {
+        const auto r = std::hypot(p[0], p[1]);
+        const bool on_side = is_close(r, 1 - p[2] / 2);
+        const bool on_cap = is_close(p[2], 0) && r < 1 + 1e-9;
+        return on_side || on_cap;
+    });
+
+    // The side's normals are perpendicular to the slant.
+    for (size_t i = 0; i < 9; ++i)
+    {
+        const auto slant = Xyz::Vector3D(0, 0, 2) - mesh.coord(i);
+        REQUIRE(std::abs(Xyz::dot(slant, mesh.normal(i))) < 1e-9);
+    }
+}
+
+TEST_CASE("Primitives: Torus")
+{
+    Xyz::Torus<double> torus{{{1, 0, 0}, {1, 0, 0}}, 3, 1, 10, 6};
+    const auto mesh = build(torus);
+    REQUIRE(Xyz::predict_mesh_size(torus) == Xyz::MeshSize{77, 360});
+    const auto [x, y, z] = Xyz::get_vectors(torus.placement.orientation);
+    check_mesh(mesh, [&](auto& p)
+    {
+        const auto d = p - torus.placement.origin;
+        const auto h = Xyz::dot(d, z);
+        const auto r = Xyz::get_length(d - h * z);
+        return is_close(std::hypot(r - 3, h), 1);
+    });
+}
+
+TEST_CASE("Primitives: Capsule")
+{
+    Xyz::Capsule<double> capsule{{{0, 0, 0}, {}}, 1, 3, 12, 4};
+    const auto mesh = build(capsule);
+    REQUIRE(Xyz::predict_mesh_size(capsule) == Xyz::MeshSize{130, 576});
+    check_mesh(mesh, [&](auto& p)
+    {
+        const auto z = std::clamp(p[2], 0.0, 3.0);
+        return is_close(Xyz::get_length(p - Xyz::Vector3D(0, 0, z)), 1);
+    });
+
+    // The v coordinate is proportional to the distance along the surface.
+    const auto length = Xyz::Constants<double>::PI + 3;
+    for (size_t i = 0; i < mesh.vertex_count(); ++i)
+    {
+        const auto v = mesh.tex_coords[2 * i + 1];
+        const auto z = mesh.coords[3 * i + 2];
+        if (z >= 0 && z <= 3)
+            REQUIRE(is_close(v * length, Xyz::Constants<double>::PI / 2 + z));
+    }
+}
+
+TEST_CASE("Primitives: GridPlane")
+{
+    Xyz::GridPlane<double> grid{{{{1, 2, 3}, {}}, {4, 2}}, 4, 2};
+    const auto mesh = build(grid);
+    REQUIRE(Xyz::predict_mesh_size(grid) == Xyz::MeshSize{15, 48});
+    check_mesh(mesh, [&](auto& p) {return is_close(p[2], 3);});
+    REQUIRE(mesh.coord(14) == Xyz::Vector3D(5, 4, 3));
+    REQUIRE(mesh.tex_coords[28] == 1);
+    REQUIRE(mesh.tex_coords[29] == 1);
+}
+
+TEST_CASE("Primitives: mirrored texture flips the tangents")
+{
+    Xyz::GridPlane<double> grid{{{{0, 0, 0}, {}}, {1, 1}}, 1, 1};
+    Mesh mesh;
+    Xyz::MeshBuilder builder{
+        .indexes = Xyz::MeshIndexBuilder<uint32_t>(mesh.indexes),
+        .coords = Builder3D(mesh.coords, 3),
+        .tangents = std::optional(Builder4D(mesh.tangents, 4))
+    };
+    Xyz::build_mesh(builder, grid, {{1, 0}, {-1, 1}});
+    REQUIRE(mesh.tangent(0) == Xyz::Vector3D(-1, 0, 0));
+    REQUIRE(mesh.tangents[3] == -1);
+}
+
+TEST_CASE("Primitives: too few segments")
+{
+    Xyz::UvSphere<double> sphere{{}, 1, 2, 8};
+    REQUIRE_THROWS_AS(Xyz::predict_mesh_size(sphere), std::invalid_argument);
+    Xyz::GridPlane<double> grid{{{}, {1, 1}}, 0, 1};
+    REQUIRE_THROWS_AS(Xyz::predict_mesh_size(grid), std::invalid_argument);
+}
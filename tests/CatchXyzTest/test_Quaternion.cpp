@@ -122,6 +122,51 @@ TEST_CASE("Quaternion: affine to_matrix adds the translation")
                        * Xyz::affine::rotate_z(angle), MARGIN));
 }
 
+TEST_CASE("Quaternion: rotate a span of vectors")
+{
+    const auto q = make_quaternion(to_radians(-71.0), Xyz::Vector3D(2, 3, -1)) * 3.0;
+    std::vector<Xyz::Vector3D> vectors{{4, -5, 6}, {1, 0, 0}, {0, 0, 0}, {-2, 7, 1}};
+    std::vector<Xyz::Vector3D> result(vectors.size());
+    rotate(q, vectors, result);
+    for (size_t i = 0; i < vectors.size(); ++i)
+        CHECK(are_equal(result[i], rotate(q, vectors[i]), MARGIN));
+
+    // In place.
+    rotate(q, vectors, vectors);
+    CHECK(vectors == result);
+
+    std::vector<Xyz::Vector3D> too_small(2);
+    CHECK_THROWS(rotate(q, vectors, too_small));
+}
+
+TEST_CASE("Quaternion: batched to_matrix")
+{
+    const std::vector<Xyz::QuaternionD> quaternions{
+        make_quaternion(to_radians(23.0), Xyz::Vector3D(1, 2, 3)),
+        make_quaternion(to_radians(-140.0), Z_AXIS),
+        {}
+    };
+    const std::vector<Xyz::Vector3D> offsets{{1, 2, 3}, {0, 0, 0}, {-4, 5, 6}};
+
+    std::vector<Xyz::Matrix3D> linear(3);
+    Xyz::linear::to_matrix(quaternions, std::span(linear));
+    std::vector<Xyz::Matrix4D> affine(3);
+    Xyz::affine::to_matrix(quaternions, offsets, std::span(affine));
+    std::vector<Xyz::Matrix4D> rotations(3);
+    Xyz::affine::to_matrix(quaternions, std::span(rotations));
+
+    for (size_t i = 0; i < quaternions.size(); ++i)
+    {
+        CHECK(linear[i] == Xyz::linear::to_matrix(quaternions[i]));
+        CHECK(affine[i] == Xyz::affine::to_matrix(quaternions[i], offsets[i]));
+        CHECK(rotations[i] == Xyz::affine::to_matrix(quaternions[i]));
+    }
+
+    CHECK_THROWS(Xyz::linear::to_matrix(quaternions, std::span(linear).first(2)));
+    CHECK_THROWS(Xyz::affine::to_matrix(quaternions, std::span(offsets).first(2),
+                                        std::span(affine)));
+}
+
 TEST_CASE("Quaternion: matrix round-trip covers all four Shepperd branches")
 {
     // Each of these picks a different largest component, so between them they
@@ -0,0 +1,198 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Xyz/QuaternionInterpolation.hpp>
+
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <Xyz/Utilities.hpp>
+
+using Xyz::to_radians;
+using Catch::Matchers::WithinAbs;
+
+namespace
+{
+    constexpr double MARGIN = 1e-12;
+
+    const Xyz::Vector3D AXIS(1, 2, 3);
+
+    /**
+     * @brief Returns the angle between the rotations @a p and @a q.
+     */
+    double get_angle_between(const Xyz::QuaternionD& p, const Xyz::QuaternionD& q)
+    {
+        return 2 * std::acos(std::min(1.0, std::abs(dot(p, q))));
+    }
+}
+
+TEST_CASE("QuaternionInterpolation: log and exp")
+{
+    const auto q = make_quaternion(to_radians(100.0), AXIS);
+    const auto l = log(q);
+    CHECK(l.w == 0);
+    CHECK_THAT(get_length(l.v), WithinAbs(to_radians(50.0), MARGIN));
+    CHECK(are_equal(exp(l), q, MARGIN));
+    CHECK(log(Xyz::QuaternionD()) == Xyz::QuaternionD(0, 0, 0, 0));
+    CHECK(exp(Xyz::QuaternionD(0, 0, 0, 0)) == Xyz::QuaternionD());
+}
+
+TEST_CASE("QuaternionInterpolation: slerp has constant angular velocity")
+{
+    const auto p = make_quaternion(to_radians(20.0), Xyz::Vector3D(0, 0, 1));
+    const auto q = make_quaternion(to_radians(130.0), AXIS) * p;
+    CHECK(are_equal(slerp(p, q, 0.0), p, MARGIN));
+    CHECK(are_equal(slerp(p, q, 1.0), q, MARGIN));
+    for (int i = 1; i < 10; ++i)
+    {
+        const auto t = i / 10.0;
+        const auto r = slerp(p, q, t);
+        CHECK_THAT(get_length(r), WithinAbs(1.0, MARGIN));
+        CHECK_THAT(get_angle_between(p, r), WithinAbs(t * to_radians(130.0), 1e-9));
+        CHECK(are_equivalent(r, make_quaternion(t * to_radians(130.0), AXIS) * p,
+                             MARGIN));
+    }
+}
+
+TEST_CASE("QuaternionInterpolation: slerp takes the shortest path")
+{
+    const auto p = make_quaternion(to_radians(10.0), AXIS);
+    const auto q = make_quaternion(to_radians(70.0), AXIS);
+    CHECK(are_equal(slerp(p, -q, 0.5), make_quaternion(to_radians(40.0), AXIS),
+                    MARGIN));
+    CHECK(are_equal(nlerp(p, -q, 0.5), make_quaternion(to_radians(40.0), AXIS),
+                    MARGIN));
+}
+
+TEST_CASE("QuaternionInterpolation: slerp of nearly equal rotations")
+{
+    const auto p = make_quaternion(to_radians(10.0), AXIS);
+    const auto q = make_quaternion(to_radians(10.001), AXIS);
+    CHECK(are_equal(slerp(p, q, 0.25), make_quaternion(to_radians(10.00025), AXIS),
+                    MARGIN));
+    CHECK(slerp(p, p, 0.5) == p);
+}
+
+TEST_CASE("QuaternionInterpolation: nlerp follows the slerp path")
+{
+    const auto p = Xyz::QuaternionD();
+    const auto q = make_quaternion(to_radians(90.0), AXIS);
+    const auto r = nlerp(p, q, 0.5);
+    CHECK(are_equal(r, slerp(p, q, 0.5), MARGIN));
+    CHECK(get_angle_between(p, nlerp(p, q, 0.25)) < to_radians(22.5));
+}
+
+TEST_CASE("QuaternionInterpolation: fast_slerp error is bounded")
+{
+    const auto p = make_quaternion(0.3, Xyz::Vector3D(1, 2, 3));
+    for (int degrees = 5; degrees < 360; degrees += 5)
+    {
+        const auto q = make_quaternion(to_radians(double(degrees)),
+                                       Xyz::Vector3D(-1, 0.5, 2)) * p;
+        const auto max_error = degrees <= 90 ? 1e-4 : 1e-3;
+        for (int i = 0; i <= 20; ++i)
+        {
+            const auto t = i / 20.0;
+            CAPTURE(degrees, t);
+            CHECK(get_angle_between(fast_slerp(p, q, t), slerp(p, q, t))
+                  < max_error);
+        }
+    }
+}
+
+TEST_CASE("QuaternionInterpolation: squad passes through the keyframes")
+{
+    const std::vector<Xyz::QuaternionD> keys{
+        {},
+        make_quaternion(to_radians(60.0), AXIS),
+        -make_quaternion(to_radians(100.0), Xyz::Vector3D(0, 1, 0)),
+        make_quaternion(to_radians(-30.0), Xyz::Vector3D(1, 0, 0))
+    };
+    const auto a1 = squad_control_point(keys[0], keys[1], keys[2]);
+    const auto a2 = squad_control_point(keys[1], keys[2], keys[3]);
+    CHECK(are_equivalent(squad(keys[1], a1, a2, keys[2], 0.0), keys[1], MARGIN));
+    CHECK(are_equivalent(squad(keys[1], a1, a2, keys[2], 1.0), keys[2], MARGIN));
+
+    // With evenly spaced keyframes on a single axis, the control points
+    // are the keyframes themselves and squad is the same as slerp.
+    const auto k0 = make_quaternion(to_radians(10.0), AXIS);
+    const auto k1 = make_quaternion(to_radians(30.0), AXIS);
+    const auto k2 = make_quaternion(to_radians(50.0), AXIS);
+    const auto k3 = make_quaternion(to_radians(70.0), AXIS);
+    const auto b1 = squad_control_point(k0, k1, k2);
+    const auto b2 = squad_control_point(k1, k2, k3);
+    CHECK(are_equal(b1, k1, MARGIN));
+    CHECK(are_equivalent(squad(k1, b1, b2, k2, 0.3), slerp(k1, k2, 0.3), MARGIN));
+}
+
+TEST_CASE("QuaternionInterpolation: squad is smooth across keyframes")
+{
+    const std::vector<Xyz::QuaternionD> keys{
+        {},
+        make_quaternion(to_radians(60.0), AXIS),
+        make_quaternion(to_radians(100.0), Xyz::Vector3D(0, 1, 0)),
+        make_quaternion(to_radians(-30.0), Xyz::Vector3D(1, 0, 0))
+    };
+    const auto a0 = squad_control_point(keys[0], keys[0], keys[1]);
+    const auto a1 = squad_control_point(keys[0], keys[1], keys[2]);
+    const auto a2 = squad_control_point(keys[1], keys[2], keys[3]);
+
+    // Compare the angular velocity on either side of keys[1].
+    constexpr double h = 1e-5;
+    const auto before = squad(keys[0], a0, a1, keys[1], 1 - h);
+    const auto after = squad(keys[1], a1, a2, keys[2], h);
+    const auto v_before = log(conjugate(before) * keys[1]).v;
+    const auto v_after = log(conjugate(keys[1]) * after).v;
+    CHECK(get_length(v_before - v_after) < 1e-3 * get_length(v_after));
+}
+
+TEST_CASE("QuaternionInterpolation: batched interpolation")
+{
+    const std::vector<Xyz::QuaternionD> p{
+        {}, make_quaternion(to_radians(10.0), AXIS), make_quaternion(1.0, AXIS)
+    };
+    const std::vector<Xyz::QuaternionD> q{
+        make_quaternion(to_radians(90.0), AXIS),
+        -make_quaternion(to_radians(170.0), Xyz::Vector3D(0, 0, 1)),
+        make_quaternion(1.0, AXIS)
+    };
+    const std::vector<double> ts{0.5, 0.2, 0.7};
+    std::vector<Xyz::QuaternionD> result(3);
+
+    Xyz::slerp(p, q, ts, std::span(result));
+    for (size_t i = 0; i < result.size(); ++i)
+        CHECK(result[i] == slerp(p[i], q[i], ts[i]));
+
+    Xyz::nlerp(p, q, ts, std::span(result));
+    for (size_t i = 0; i < result.size(); ++i)
+        CHECK(result[i] == nlerp(p[i], q[i], ts[i]));
+
+    Xyz::fast_slerp(p, q, ts, std::span(result));
+    for (size_t i = 0; i < result.size(); ++i)
+        CHECK(result[i] == fast_slerp(p[i], q[i], ts[i]));
+
+    CHECK_THROWS(Xyz::slerp(p, q, std::span(ts).first(2), std::span(result)));
+}
+
+TEST_CASE("QuaternionInterpolation: sample_keyframes")
+{
+    const std::vector<double> times{0, 1, 3};
+    const std::vector<Xyz::QuaternionD> keys{
+        {},
+        make_quaternion(to_radians(40.0), AXIS),
+        make_quaternion(to_radians(80.0), AXIS)
+    };
+    CHECK(sample_keyframes(times, keys, -1.0) == keys[0]);
+    CHECK(sample_keyframes(times, keys, 5.0) == keys[2]);
+    CHECK(sample_keyframes(times, keys, 1.0) == slerp(keys[1], keys[2], 0.0));
+    CHECK(are_equal(sample_keyframes(times, keys, 0.5),
+                    make_quaternion(to_radians(20.0), AXIS), MARGIN));
+    CHECK(are_equal(sample_keyframes(times, keys, 2.5),
+                    make_quaternion(to_radians(70.0), AXIS), MARGIN));
+    CHECK_THROWS(sample_keyframes(std::span(times).first(2), keys, 0.5));
+}
@@ -0,0 +1,137 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Xyz/SegmentIntersections.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+namespace
+{
+    using Segment = Xyz::LineSegment<double, 2>;
+    using V2 = Xyz::Vector2D;
+
+    std::vector<std::pair<size_t, size_t>>
+    get_pairs(const std::vector<Xyz::SegmentIntersection<double>>& intersections)
+    {
+        std::vector<std::pair<size_t, size_t>> result;
+        for (const auto& isect : intersections)
+            result.emplace_back(isect.first, isect.second);
+        return result;
+    }
+
+    std::vector<std::pair<size_t, size_t>>
+    find_pairs_brute_force(const std::vector<Segment>& segments)
+    {
+        std::vector<std::pair<size_t, size_t>> result;
+        for (size_t i = 0; i < segments.size(); ++i)
+        {
+            for (size_t j = i + 1; j < segments.size(); ++j)
+            {
+                if (Xyz::Details::get_segment_intersection<double, double>(
+                        segments, i, j, Xyz::Margin<double>::DEFAULT))
+                {
+                    result.emplace_back(i, j);
+                }
+            }
+        }
+        return result;
+    }
+}
+
+TEST_CASE("SegmentIntersections: simple crossings")
+{
+    const std::vector<Segment> segments{
+        {V2(0, 0), V2(4, 4)},
+        {V2(0, 4), V2(4, 0)},
+        {V2(2, -1), V2(2, 5)},   // Vertical, through the crossing of 0 and 1.
+        {V2(5, 0), V2(6, 1)},    // Alone.
+        {V2(4, 4), V2(6, 4)},    // Touches 0 at its end point.
+    };
+    const auto result = Xyz::find_segment_intersections<double>(segments);
+    REQUIRE(result.size() == 3);
+    CHECK(result[0].first == 0);
+    CHECK(result[0].second == 1);
+    CHECK(result[0].type == Xyz::IntersectionType::INTERSECTING);
+    CHECK(Xyz::Approx(result[0].first_extent.first) == 0.5);
+    CHECK(Xyz::Approx(result[0].second_extent.first) == 0.5);
+    CHECK(get_pairs(result) == std::vector<std::pair<size_t, size_t>>{{0, 1}, {0, 2}, {1, 2}});
+    CHECK(Xyz::Approx(result[1].second_extent.first) == 0.5);
+}
+
+TEST_CASE("SegmentIntersections: colinear segments")
+{
+    const std::vector<Segment> segments{
+        {V2(0, 0), V2(4, 2)},
+        {V2(6, 3), V2(2, 1)},    // Overlaps 0 from (2, 1) to (4, 2).
+        {V2(-2, -1), V2(0, 0)},  // Touches 0 at its start.
+        {V2(1, 0.5), V2(5, 2.5)},// Overlaps 0 and 1.
+        {V2(0, 2), V2(4, 0)},    // Crosses 0 and 3.
+    };
+    const auto result = Xyz::find_segment_intersections<double>(segments);
+    CHECK(get_pairs(result) == find_pairs_brute_force(segments));
+    CHECK(get_pairs(result) == std::vector<std::pair<size_t, size_t>>{
+        {0, 1}, {0, 3}, {0, 4}, {1, 3}, {3, 4}});
+    REQUIRE(result[0].type == Xyz::IntersectionType::OVERLAPPING);
+    // The extents are ordered as get_projection_extents orders them.
+    const auto [from, to] = std::minmax(result[0].first_extent.first,
+                                        result[0].first_extent.second);
+    CHECK(Xyz::Approx(from) == 0.5);
+    CHECK(Xyz::Approx(to) == 1.0);
+}
+
+TEST_CASE("SegmentIntersections: nearly parallel segments")
+{
+    // The cross product of the directions is far below the default
+    // margin, but the segments still cross at their midpoints.
+    const std::vector<Segment> segments{
+        {V2(0, 0), V2(1, 1e-15)},
+        {V2(0, 1e-15), V2(1, 0)},
+        {V2(0, 2e-15), V2(1, 3e-15)},  // Parallel to 0, but not colinear.
+    };
+    const auto result = Xyz::find_segment_intersections<double>(segments);
+    REQUIRE(result.size() == 1);
+    CHECK(result[0].first == 0);
+    CHECK(result[0].second == 1);
+    CHECK(result[0].type == Xyz::IntersectionType::INTERSECTING);
+    CHECK(Xyz::Approx(result[0].first_extent.first) == 0.5);
+    CHECK(Xyz::Approx(result[0].second_extent.first) == 0.5);
+}
+
+TEST_CASE("SegmentIntersections: random segments match brute force")
+{
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<double> coord(0, 100);
+    std::uniform_real_distribution<double> offset(-15, 15);
+    std::vector<Segment> segments;
+    for (int i = 0; i < 400; ++i)
+    {
+        const V2 p(coord(rng), coord(rng));
+        segments.emplace_back(p, p + V2(offset(rng), offset(rng)));
+    }
+    CHECK(get_pairs(Xyz::find_segment_intersections<double>(segments))
+          == find_pairs_brute_force(segments));
+}
+
+TEST_CASE("SegmentIntersections: grid with shared end points matches brute force")
+{
+    // Integer coordinates give many vertical and horizontal segments,
+    // shared end points, several segments through the same point, and
+    // colinear overlaps.
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> coord(0, 12);
+    std::vector<Segment> segments;
+    for (int i = 0; i < 300; ++i)
+    {
+        segments.emplace_back(V2(coord(rng), coord(rng)),
+                              V2(coord(rng), coord(rng)));
+    }
+    CHECK(get_pairs(Xyz::find_segment_intersections<double>(segments))
+          == find_pairs_brute_force(segments));
+}
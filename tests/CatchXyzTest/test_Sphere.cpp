@@ -0,0 +1,198 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Xyz/Sphere.hpp>
+#include <Xyz/TransformationMatrix.hpp>
+#include <Xyz/Utilities.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <thread>
+#include <vector>
+
+using Catch::Matchers::WithinAbs;
+
+namespace
+{
+    using V2 = Xyz::Vector2D;
+    using V3 = Xyz::Vector3D;
+
+    template <unsigned N>
+    void check_contains_all(const Xyz::Sphere<double, N>& sphere,
+                            const std::vector<Xyz::Vector<double, N>>& points)
+    {
+        const Xyz::Sphere<double, N> inflated{sphere.center,
+                                              sphere.radius + 1e-9};
+        for (const auto& p : points)
+        {
+            CAPTURE(p);
+            CHECK(contains_point(inflated, p));
+        }
+    }
+
+    std::vector<V3> make_random_points(size_t count)
+    {
+        std::default_random_engine engine(1234);
+        std::uniform_real_distribution<double> dist(-1, 1);
+        std::vector<V3> points;
+        for (size_t i = 0; i < count; ++i)
+            points.emplace_back(5 + dist(engine), dist(engine), 3 * dist(engine));
+        return points;
+    }
+}
+
+TEST_CASE("Sphere: empty")
+{
+    Xyz::SphereD s;
+    CHECK_FALSE(s);
+    CHECK_FALSE(contains_point(s, V3()));
+    const std::vector<V3> points;
+    CHECK_FALSE(Xyz::compute_bounding_sphere(std::span<const V3>(points)));
+    CHECK_FALSE(Xyz::compute_minimal_bounding_sphere(std::span<const V3>(points)));
+}
+
+TEST_CASE("Sphere: merge")
+{
+    const Xyz::SphereD a{{0, 0, 0}, 1};
+    const Xyz::SphereD b{{4, 0, 0}, 1};
+    const auto ab = merge(a, b);
+    CHECK(are_equal(ab.center, V3(2, 0, 0), 1e-12));
+    CHECK_THAT(ab.radius, WithinAbs(3, 1e-12));
+
+    // One contains the other.
+    const Xyz::SphereD c{{0.5, 0, 0}, 3};
+    CHECK(merge(a, c) == c);
+    CHECK(merge(c, a) == c);
+
+    CHECK(merge(a, Xyz::SphereD()) == a);
+    CHECK(merge(Xyz::SphereD(), a) == a);
+}
+
+TEST_CASE("Sphere: Ritter bounding sphere")
+{
+    const auto points = make_random_points(1000);
+    const auto sphere = Xyz::compute_bounding_sphere(std::span<const V3>(points));
+    REQUIRE(sphere);
+    check_contains_all(sphere, points);
+}
+
+TEST_CASE("Sphere: minimal bounding sphere in 2D")
+{
+    // The minimal circle is determined by the two points farthest apart.
+    const std::vector<V2> points = {{0, 0}, {4, 0}, {2, 1}, {1, -1}, {3, 0.5}};
+    const auto circle = Xyz::compute_minimal_bounding_sphere(
+        std::span<const V2>(points));
+    CHECK(are_equal(circle.center, V2(2, 0), 1e-12));
+    CHECK_THAT(circle.radius, WithinAbs(2, 1e-12));
+    check_contains_all(circle, points);
+
+    // An equilateral triangle, the circle goes through all three corners.
+    const std::vector<V2> triangle = {{0, 0}, {2, 0}, {1, std::sqrt(3.0)}};
+    const auto c2 = Xyz::compute_minimal_bounding_sphere(
+        std::span<const V2>(triangle));
+    CHECK(are_equal(c2.center, V2(1, 1 / std::sqrt(3.0)), 1e-12));
+    CHECK_THAT(c2.radius, WithinAbs(2 / std::sqrt(3.0), 1e-12));
+}
+
+TEST_CASE("Sphere: minimal bounding sphere in 3D")
+{
+    const auto points = make_random_points(1000);
+    const auto minimal = Xyz::compute_minimal_bounding_sphere(
+        std::span<const V3>(points));
+    check_contains_all(minimal, points);
+
+    const auto ritter = Xyz::compute_bounding_sphere(std::span<const V3>(points));
+    CHECK(minimal.radius <= ritter.radius + 1e-12);
+
+    // Regular tetrahedron, the sphere goes through all four corners.
+    const std::vector<V3> tetrahedron = {{1, 1, 1}, {1, -1, -1},
+                                         {-1, 1, -1}, {-1, -1, 1}};
+    const auto t = Xyz::compute_minimal_bounding_sphere(
+        std::span<const V3>(tetrahedron));
+    CHECK(are_equal(t.center, V3(0, 0, 0), 1e-12));
+    CHECK_THAT(t.radius, WithinAbs(std::sqrt(3.0), 1e-12));
+}
+
+TEST_CASE("Sphere: minimal bounding sphere from several threads")
+{
+    const auto points = make_random_points(2000);
+    const auto expected = Xyz::compute_minimal_bounding_sphere(
+        std::span<const V3>(points));
+
+    Xyz::SphereD results[4];
+    std::vector<std::thread> threads;
+    for (auto& result : results)
+    {
+        threads.emplace_back([&points, &result]
+        {
+            result = Xyz::compute_minimal_bounding_sphere(
+                std::span<const V3>(points));
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    // The default engine has a fixed seed, so the results are identical.
+    for (const auto& result : results)
+        CHECK(result == expected);
+}
+
+TEST_CASE("Sphere: minimal bounding sphere of degenerate points")
+{
+    // Collinear points and duplicates.
+    const std::vector<V3> points = {{0, 0, 0}, {1, 1, 1}, {2, 2, 2},
+                                    {1, 1, 1}, {0, 0, 0}, {3, 3, 3}};
+    const auto sphere = Xyz::compute_minimal_bounding_sphere(
+        std::span<const V3>(points));
+    CHECK(are_equal(sphere.center, V3(1.5, 1.5, 1.5), 1e-12));
+    CHECK_THAT(sphere.radius, WithinAbs(1.5 * std::sqrt(3.0), 1e-12));
+
+    const std::vector<V3> one = {{1, 2, 3}};
+    const auto s1 = Xyz::compute_minimal_bounding_sphere(
+        std::span<const V3>(one));
+    CHECK(s1 == Xyz::SphereD{{1, 2, 3}, 0});
+}
+
+TEST_CASE("Sphere: transform")
+{
+    const Xyz::SphereD sphere{{1, 0, 0}, 2};
+
+    SECTION("Rotation and translation")
+    {
+        const auto m = Xyz::affine::translate3<double>({0, 0, 5})
+                       * Xyz::affine::rotate_z<double>(Xyz::to_radians(90.0));
+        const auto t = transform_sphere(sphere, m);
+        CHECK(are_equal(t.center, V3(0, 1, 5), 1e-12));
+        CHECK_THAT(t.radius, WithinAbs(2, 1e-12));
+    }
+    SECTION("Non-uniform scaling after rotation")
+    {
+        const auto m = Xyz::affine::scale3<double>({3, 1, 1})
+                       * Xyz::affine::rotate_z<double>(Xyz::to_radians(45.0));
+        const auto t = transform_sphere(sphere, m);
+        CHECK_THAT(t.radius, WithinAbs(6, 1e-9));
+    }
+}
+
+TEST_CASE("Sphere: intersects")
+{
+    const Xyz::SphereD s{{0, 0, 0}, 1};
+
+    CHECK(intersects(s, Xyz::SphereD{{2, 0, 0}, 1}));
+    CHECK_FALSE(intersects(s, Xyz::SphereD{{2.1, 0, 0}, 1}));
+
+    CHECK(intersects(s, Xyz::BBox3D({0.5, 0.5, -1}, {2, 2, 1})));
+    // Inside the box' bounding sphere, but outside the box.
+    CHECK_FALSE(intersects(s, Xyz::BBox3D({0.75, 0.75, -1}, {2, 2, 1})));
+    CHECK(intersects(Xyz::BBox3D({-5, -5, -5}, {5, 5, 5}), s));
+    CHECK_FALSE(intersects(s, Xyz::BBox3D()));
+
+    const Xyz::Plane<double> plane{{0, 0, 0.5}, {0, 0, 2}};
+    CHECK(intersects(s, plane));
+    CHECK(intersects(plane, Xyz::SphereD{{0, 0, -0.5}, 1}));
+    CHECK_FALSE(intersects(Xyz::SphereD{{0, 0, -0.6}, 1}, plane));
+}
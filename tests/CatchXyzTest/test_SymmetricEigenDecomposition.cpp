@@ -0,0 +1,84 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Xyz/SymmetricEigenDecomposition.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+using Catch::Matchers::WithinAbs;
+
+namespace
+{
+    template <typename T, unsigned N>
+    void check_decomposition(const Xyz::Matrix<T, N, N>& m,
+                             const Xyz::SymmetricEigenDecomposition<T, N>& e,
+                             T margin)
+    {
+        for (unsigned i = 0; i < N; ++i)
+        {
+            CAPTURE(i);
+            const auto v = get_col(e.vectors, i);
+            CHECK_THAT(get_length(v), WithinAbs(1, margin));
+            CHECK(are_equal(m * v, v * e.values[i], margin));
+            if (i > 0)
+                CHECK(e.values[i - 1] >= e.values[i]);
+            for (unsigned j = 0; j < i; ++j)
+                CHECK_THAT(dot(v, get_col(e.vectors, j)), WithinAbs(0, margin));
+        }
+    }
+}
+
+TEST_CASE("SymmetricEigenDecomposition: diagonal matrix")
+{
+    const Xyz::Matrix3D m{
+        2, 0, 0,
+        0, 5, 0,
+        0, 0, -1
+    };
+    const auto e = Xyz::get_symmetric_eigen_decomposition(m);
+    CHECK(e.values == Xyz::Vector3D(5, 2, -1));
+    check_decomposition(m, e, 1e-12);
+}
+
+TEST_CASE("SymmetricEigenDecomposition: 2x2 matrix")
+{
+    const Xyz::Matrix2D m{
+        2, 1,
+        1, 2
+    };
+    const auto e = Xyz::get_symmetric_eigen_decomposition(m);
+    CHECK_THAT(e.values[0], WithinAbs(3, 1e-12));
+    CHECK_THAT(e.values[1], WithinAbs(1, 1e-12));
+    check_decomposition(m, e, 1e-12);
+}
+
+TEST_CASE("SymmetricEigenDecomposition: full 3x3 matrix")
+{
+    const Xyz::Matrix3D m{
+        4, 1, -2,
+        1, 2, 0.5,
+        -2, 0.5, 3
+    };
+    const auto e = Xyz::get_symmetric_eigen_decomposition(m);
+    check_decomposition(m, e, 1e-10);
+    // The trace is the sum of the eigenvalues.
+    CHECK_THAT(e.values[0] + e.values[1] + e.values[2], WithinAbs(9, 1e-10));
+}
+
+TEST_CASE("SymmetricEigenDecomposition: repeated eigenvalues")
+{
+    const Xyz::Matrix3F m{
+        2, 1, 1,
+        1, 2, 1,
+        1, 1, 2
+    };
+    const auto e = Xyz::get_symmetric_eigen_decomposition(m);
+    CHECK_THAT(e.values[0], WithinAbs(4, 1e-5));
+    CHECK_THAT(e.values[1], WithinAbs(1, 1e-5));
+    CHECK_THAT(e.values[2], WithinAbs(1, 1e-5));
+    check_decomposition(m, e, 1e-5f);
+}
@@ -0,0 +1,122 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Xyz/Transform.hpp>
+
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+#include <Xyz/InvertMatrix.hpp>
+#include <Xyz/TransformationMatrix.hpp>
+#include <Xyz/Utilities.hpp>
+
+using Xyz::to_radians;
+
+namespace
+{
+    constexpr double MARGIN = 1e-12;
+
+    using NonUniformTransformD = Xyz::Transform<double, Xyz::Vector3D>;
+
+    Xyz::Vector3D transform(const Xyz::Matrix4D& m, const Xyz::Vector3D& p)
+    {
+        const auto v = m * make_vector4(p, 1.0);
+        return {v[0], v[1], v[2]};
+    }
+
+    const Xyz::TransformD A{
+        {1, 2, 3}, make_quaternion(to_radians(40.0), Xyz::Vector3D(1, 2, 3)), 2
+    };
+    const Xyz::TransformD B{
+        {-4, 0, 1}, make_quaternion(to_radians(-110.0), Xyz::Vector3D(0, 1, 1)), 0.5
+    };
+}
+
+TEST_CASE("Transform: default is the identity")
+{
+    const Xyz::TransformD t;
+    CHECK(transform_point(t, Xyz::Vector3D(1, 2, 3)) == Xyz::Vector3D(1, 2, 3));
+    CHECK(Xyz::affine::to_matrix(t) == Xyz::make_identity_matrix<double, 4>());
+    CHECK(NonUniformTransformD().scale == Xyz::Vector3D(1, 1, 1));
+}
+
+TEST_CASE("Transform: scale, then rotate, then translate")
+{
+    const Xyz::Vector3D p(1, -1, 0.5);
+    CHECK(are_equal(transform_point(A, p),
+                    rotate(A.rotation, 2.0 * p) + A.translation, MARGIN));
+    CHECK(are_equal(transform_vector(A, p), rotate(A.rotation, 2.0 * p), MARGIN));
+
+    const auto m = Xyz::affine::to_matrix(A);
+    CHECK(are_equal(m, Xyz::affine::translate3(A.translation)
+                       * Xyz::affine::to_matrix(A.rotation)
+                       * Xyz::affine::scale3(2.0, 2.0, 2.0), MARGIN));
+    CHECK(are_equal(transform(m, p), transform_point(A, p), MARGIN));
+}
+
+TEST_CASE("Transform: composition matches the matrix product")
+{
+    const auto ab = A * B;
+    CHECK(are_equal(Xyz::affine::to_matrix(ab),
+                    Xyz::affine::to_matrix(A) * Xyz::affine::to_matrix(B), MARGIN));
+    const Xyz::Vector3D p(3, 1, -2);
+    CHECK(are_equal(transform_point(ab, p),
+                    transform_point(A, transform_point(B, p)), MARGIN));
+}
+
+TEST_CASE("Transform: inverse")
+{
+    const auto inv = invert(A);
+    CHECK(are_equal(inv * A, Xyz::TransformD(), MARGIN));
+    CHECK(are_equal(A * inv, Xyz::TransformD(), MARGIN));
+    CHECK(are_equal(Xyz::affine::to_matrix(inv),
+                    Xyz::invert(Xyz::affine::to_matrix(A)), MARGIN));
+    CHECK_THROWS(invert(Xyz::TransformD{{}, {}, 0}));
+}
+
+TEST_CASE("Transform: non-uniform scale")
+{
+    const NonUniformTransformD parent{
+        {1, 0, 0}, make_quaternion(to_radians(90.0), Xyz::Vector3D(0, 0, 1)), {2, 3, 4}
+    };
+    const NonUniformTransformD child{{0, 1, 0}, {}, {0.5, 1, 2}};
+    CHECK(are_equal(Xyz::affine::to_matrix(parent * child),
+                    Xyz::affine::to_matrix(parent) * Xyz::affine::to_matrix(child),
+                    MARGIN));
+    CHECK(are_equal(transform_point(parent, Xyz::Vector3D(1, 1, 1)),
+                    Xyz::Vector3D(-2, 2, 4), MARGIN));
+
+    // Exact, as the child has no rotation.
+    CHECK(are_equal(Xyz::affine::to_matrix(invert(child)),
+                    Xyz::invert(Xyz::affine::to_matrix(child)), MARGIN));
+    CHECK_THROWS(invert(NonUniformTransformD{{}, {}, {1, 0, 1}}));
+}
+
+TEST_CASE("Transform: from placement")
+{
+    const Xyz::Placement<double, 3> placement{
+        {1, 2, 3}, {to_radians(30.0), to_radians(20.0), to_radians(10.0)}
+    };
+    const auto t = make_transform(placement);
+    CHECK(t.scale == 1);
+    CHECK(are_equal(Xyz::affine::to_matrix(t),
+                    Xyz::affine::translate3(placement.origin)
+                    * Xyz::affine::to_matrix(to_quaternion(placement.orientation)),
+                    MARGIN));
+    const auto s = make_transform(placement, Xyz::Vector3D(1, 2, 3));
+    CHECK(s.scale == Xyz::Vector3D(1, 2, 3));
+}
+
+TEST_CASE("Transform: batched to_matrix")
+{
+    const std::vector<Xyz::TransformD> transforms{A, B, A * B};
+    std::vector<Xyz::Matrix4D> matrixes(3);
+    Xyz::affine::to_matrix(transforms, std::span(matrixes));
+    for (size_t i = 0; i < transforms.size(); ++i)
+        CHECK(matrixes[i] == Xyz::affine::to_matrix(transforms[i]));
+    CHECK_THROWS(Xyz::affine::to_matrix(transforms, std::span(matrixes).first(2)));
+}
@@ -0,0 +1,102 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Xyz/TransformHierarchy.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <Xyz/Quaternion.hpp>
+#include <Xyz/TransformationMatrix.hpp>
+
+namespace
+{
+    using Hierarchy = Xyz::TransformHierarchy<double>;
+    constexpr auto NO_PARENT = Hierarchy::NO_PARENT;
+
+    Xyz::Matrix4D make_local_matrix(size_t i)
+    {
+        return Xyz::affine::to_matrix(
+            make_quaternion(0.1 * double(i % 17), Xyz::Vector3D(1, double(i % 3), 2)),
+            Xyz::Vector3D(double(i % 5), 1, -double(i % 7)));
+    }
+
+    Xyz::Matrix4D compute_world_matrix(const Hierarchy& h, Hierarchy::NodeIndex node)
+    {
+        auto m = h.local_matrix(node);
+        for (auto p = h.parent(node); p != NO_PARENT; p = h.parent(p))
+            m = h.local_matrix(p) * m;
+        return m;
+    }
+}
+
+TEST_CASE("TransformHierarchy: world matrices")
+{
+    //     0       4
+    //    / \      |
+    //   1   2     5
+    //   |
+    //   3
+    const std::vector<Hierarchy::NodeIndex> parents{NO_PARENT, 0, 0, 1, NO_PARENT, 4};
+    Hierarchy h(parents);
+    REQUIRE(h.size() == 6);
+    REQUIRE(h.level(3) == 2);
+    for (Hierarchy::NodeIndex i = 0; i < h.size(); ++i)
+        h.set_local_matrix(i, make_local_matrix(i));
+
+    REQUIRE(h.update() == 6);
+    for (Hierarchy::NodeIndex i = 0; i < h.size(); ++i)
+    {
+        CHECK(!h.is_dirty(i));
+        CHECK(are_equal(h.world_matrix(i), compute_world_matrix(h, i), 1e-12));
+    }
+    CHECK(h.update() == 0);
+
+    // Only node 1 and its descendant are recomputed.
+    h.set_local_matrix(1, Xyz::affine::translate3(Xyz::Vector3D(0, 0, 10)));
+    CHECK(h.is_dirty(1));
+    CHECK(!h.is_dirty(3));
+    const auto world_2 = h.world_matrix(2);
+    CHECK(h.update() == 2);
+    CHECK(h.world_matrix(2) == world_2);
+    CHECK(are_equal(h.world_matrix(3), compute_world_matrix(h, 3), 1e-12));
+
+    CHECK(are_equal(h.inverse_world_matrix(3) * h.world_matrix(3),
+                    Xyz::make_identity_matrix<double, 4>(), 1e-12));
+}
+
+TEST_CASE("TransformHierarchy: nodes added after update")
+{
+    Hierarchy h;
+    const auto root = h.add_node(NO_PARENT, make_local_matrix(1));
+    h.update();
+    const auto child = h.add_node(root, make_local_matrix(2));
+    const auto grandchild = h.add_node(child, make_local_matrix(3));
+    CHECK(h.update() == 2);
+    CHECK(are_equal(h.world_matrix(grandchild),
+                    compute_world_matrix(h, grandchild), 1e-12));
+    CHECK_THROWS(h.add_node(7));
+    CHECK_THROWS(Hierarchy(std::vector<Hierarchy::NodeIndex>{0}));
+}
+
+TEST_CASE("TransformHierarchy: multithreaded update")
+{
+    // A wide hierarchy with 4 levels of 3000 nodes each.
+    constexpr size_t WIDTH = 3000;
+    Hierarchy h;
+    for (size_t i = 0; i < WIDTH; ++i)
+        h.add_node(NO_PARENT, make_local_matrix(i));
+    for (size_t i = WIDTH; i < 4 * WIDTH; ++i)
+        h.add_node(Hierarchy::NodeIndex(i - WIDTH - i % 2), make_local_matrix(i));
+    CHECK(h.update(4) == 4 * WIDTH);
+    CHECK(h.level(Hierarchy::NodeIndex(4 * WIDTH - 1)) == 3);
+
+    for (size_t i = 0; i < WIDTH; i += 2)
+        h.set_local_matrix(Hierarchy::NodeIndex(i), make_local_matrix(i + 1));
+    h.update(4);
+    for (Hierarchy::NodeIndex i = 0; i < h.size(); i += 7)
+        CHECK(are_equal(h.world_matrix(i), compute_world_matrix(h, i), 1e-9));
+}
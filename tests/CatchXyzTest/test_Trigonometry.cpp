@@ -0,0 +1,86 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Xyz/Trigonometry.hpp>
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+
+namespace
+{
+    template <typename T>
+    double max_sincos_error(double max_angle, int steps)
+    {
+        double error = 0;
+        for (int i = -steps; i <= steps; ++i)
+        {
+            const auto angle = T(max_angle * i / steps);
+            const auto [s, c] = Xyz::fast_sincos(angle);
+            error = std::max({error,
+                              std::abs(double(s) - std::sin(double(angle))),
+                              std::abs(double(c) - std::cos(double(angle)))});
+        }
+        return error;
+    }
+
+    template <typename T>
+    double max_atan2_error(int steps)
+    {
+        double error = 0;
+        for (int i = 0; i < steps; ++i)
+        {
+            const auto angle = 2 * Xyz::Constants<double>::PI * i / steps;
+            for (const auto r : {1e-3, 1.0, 250.0})
+            {
+                const auto y = T(r * std::sin(angle));
+                const auto x = T(r * std::cos(angle));
+                error = std::max(error, std::abs(double(Xyz::fast_atan2(y, x))
+                                                 - std::atan2(double(y), double(x))));
+            }
+        }
+        return error;
+    }
+}
+
+TEST_CASE("Trigonometry: sincos")
+{
+    const auto [s, c] = Xyz::sincos(0.5);
+    CHECK(s == std::sin(0.5));
+    CHECK(c == std::cos(0.5));
+}
+
+TEST_CASE("Trigonometry: fast_sincos error")
+{
+    CHECK(max_sincos_error<double>(10, 100000) < 1e-11);
+    CHECK(max_sincos_error<double>(1e5, 100000) < 1e-11);
+    CHECK(max_sincos_error<float>(10, 100000) < 1e-7);
+    CHECK(max_sincos_error<float>(1e5, 100000) < 1e-7);
+
+    // The quadrants are correct.
+    const auto [s, c] = Xyz::fast_sincos(-3 * Xyz::Constants<double>::PI / 4);
+    CHECK(s < 0);
+    CHECK(c < 0);
+}
+
+TEST_CASE("Trigonometry: fast_atan2 error")
+{
+    CHECK(max_atan2_error<double>(10000) < 1e-10);
+    CHECK(max_atan2_error<float>(10000) < 5e-7);
+    CHECK(Xyz::fast_atan2(0.0, 0.0) == 0);
+    CHECK(Xyz::fast_atan2(0.0, -1.0) == Xyz::Constants<double>::PI);
+}
+
+TEST_CASE("Trigonometry: fast_asin error")
+{
+    double error = 0;
+    for (int i = -1000; i <= 1000; ++i)
+    {
+        const auto x = i / 1000.0;
+        error = std::max(error, std::abs(Xyz::fast_asin(x) - std::asin(x)));
+    }
+    CHECK(error < 1e-10);
+}
@@ -0,0 +1,111 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Xyz/Mesh/BuildMesh.hpp>
+#include <Xyz/Mesh/WeldVertexes.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+namespace
+{
+    using Builder3F = Xyz::MeshAttributeBuilder<Xyz::Vector3F, std::vector<float>>;
+
+    // Returns the coordinates of every index, i.e. the triangles as they
+    // are drawn.
+    std::vector<Xyz::Vector3F> get_triangles(const std::vector<float>& buffer,
+                                             size_t stride,
+                                             const std::vector<uint32_t>& indexes)
+    {
+        std::vector<Xyz::Vector3F> result;
+        for (const auto index : indexes)
+        {
+            const auto* row = buffer.data() + index * stride;
+            result.emplace_back(row[0], row[1], row[2]);
+        }
+        return result;
+    }
+}
+
+TEST_CASE("WeldVertexes: cuboids with coordinates only")
+{
+    std::vector<uint32_t> indexes;
+    std::vector<float> buffer;
+    Xyz::MeshBuilder builder{
+        .indexes = Xyz::MeshIndexBuilder<uint32_t>(indexes),
+        .coords = Builder3F(buffer, 3)
+    };
+
+    // Two cuboids that share a face.
+    Xyz::build_mesh(builder, Xyz::OrientedCuboid<float>{{{0, 0, 0}, {}}, {1, 1, 1}});
+    Xyz::build_mesh(builder, Xyz::OrientedCuboid<float>{{{1, 0, 0}, {}}, {1, 1, 1}},
+                    {}, 24);
+    REQUIRE(buffer.size() == 48 * 3);
+
+    const auto triangles = get_triangles(buffer, 3, indexes);
+    const auto count = Xyz::weld_vertexes(buffer, 3, indexes);
+    CHECK(count == 12);
+    CHECK(buffer.size() == 12 * 3);
+    CHECK(indexes.size() == 72);
+    CHECK(get_triangles(buffer, 3, indexes) == triangles);
+}
+
+TEST_CASE("WeldVertexes: interleaved coordinates and normals")
+{
+    std::vector<uint32_t> indexes;
+    std::vector<float> buffer;
+    Xyz::MeshBuilder builder{
+        .indexes = Xyz::MeshIndexBuilder<uint32_t>(indexes),
+        .coords = Builder3F(buffer, 6),
+        .normals = std::optional(Builder3F(buffer, 6, 3))
+    };
+
+    const Xyz::OrientedCuboid<float> cuboid{{{0, 0, 0}, {}}, {1, 1, 1}};
+    Xyz::build_mesh(builder, cuboid);
+    Xyz::build_mesh(builder, cuboid, {}, 24);
+
+    const auto triangles = get_triangles(buffer, 6, indexes);
+    // The corners are shared by faces with different normals, only the
+    // second cuboid is a duplicate.
+    CHECK(Xyz::weld_vertexes(buffer, 6, indexes) == 24);
+    CHECK(get_triangles(buffer, 6, indexes) == triangles);
+    for (size_t i = 0; i < indexes.size(); ++i)
+        CHECK(indexes[i] == indexes[i % 36]);
+}
+
+TEST_CASE("WeldVertexes: epsilon")
+{
+    std::vector<float> buffer = {
+        0, 0, 1,
+        1e-5f, -0.0f, 1,
+        0, 0, 1.01f,
+        -0.0f, 0, 1
+    };
+    std::vector<uint32_t> indexes = {0, 1, 2, 3};
+
+    SECTION("Exact")
+    {
+        CHECK(Xyz::weld_vertexes(buffer, 3, indexes) == 3);
+        CHECK(indexes == std::vector<uint32_t>{0, 1, 2, 0});
+    }
+    SECTION("Quantized")
+    {
+        CHECK(Xyz::weld_vertexes(buffer, 3, indexes, 1e-3f) == 2);
+        CHECK(indexes == std::vector<uint32_t>{0, 0, 1, 0});
+        CHECK(buffer == std::vector<float>{0, 0, 1, 0, 0, 1.01f});
+    }
+}
+
+TEST_CASE("WeldVertexes: invalid arguments")
+{
+    std::vector<float> buffer(6);
+    std::vector<uint32_t> indexes = {0, 2};
+    CHECK_THROWS(Xyz::weld_vertexes(buffer, 3, indexes));
+    indexes = {0, 1};
+    CHECK_THROWS(Xyz::weld_vertexes(buffer, 4, indexes));
+    CHECK(Xyz::weld_vertexes(buffer, 3, indexes) == 1);
+}